@@ -0,0 +1,39 @@
+#pragma once
+
+/**
+ * AllocationCounter: Yığın bellek ayırma sayacı (ölçüm ve testler için).
+ *
+ * Sayaç iş parçacığı başınadır, bu yüzden ölçüm paylaşılan bir önbellek
+ * satırına yazmaz. Kütüphane sadece sayacı tutar; global operator new'i
+ * değiştirip her ayırmada record() çağıran kancalar src/testing/AllocationHooks.cpp
+ * içindedir ve yalnızca o dosyayı derleyen hedeflerde (test_*, microbench)
+ * sayılır. Kancasız bir programda count() hep 0 döner. Bir kod parçasının
+ * ayırma sayısı Scope ile okunur:
+ *
+ *   AllocationCounter::Scope scope;
+ *   search.improveSchedule(schedule, 1);
+ *   long long allocations = scope.count();
+ *
+ * Sadece çağıran iş parçacığındaki ayırmalar sayılır; havuz işçilerininkiler dahil değildir.
+ */
+class AllocationCounter {
+public:
+    // Bu iş parçacığında program başından beri yapılan ayırma sayısı
+    static long long count();
+
+    // Bu iş parçacığının sayacını bir artırır (ayırma kancaları çağırır)
+    static void record() noexcept;
+
+    /**
+     * Oluşturulduğu andan itibaren bu iş parçacığındaki ayırmaları sayar.
+     */
+    class Scope {
+    private:
+        long long start_;
+
+    public:
+        Scope() : start_(AllocationCounter::count()) {}
+
+        long long count() const { return AllocationCounter::count() - start_; }
+    };
+};
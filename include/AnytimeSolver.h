@@ -0,0 +1,159 @@
+#pragma once
+
+#include "Models.h"
+#include "Cancellation.h"
+#include "Heuristics.h"
+#include "TabuSearch.h"
+#include "SimulatedAnnealing.h"
+#include "LowerBounds.h"
+#include <atomic>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+
+/**
+ * BestSolutionSlot: Çözücünün yayımladığı "şimdiye kadarki en iyi" çözüm.
+ *
+ * Tek yazıcı (çözücü), çok okuyucu (ör. UI). makespan() ve version() kilitsiz
+ * atomik okumadır; load() yayımlanmış son çizelgenin değişmez bir kopyasını
+ * paylaşır, okuyucu onu istediği kadar tutabilir. Yazıcı her iyileşmede yeni
+ * bir kopya yayımlar; eski kopyalar son okuyucu bırakınca serbest kalır.
+ *
+ * load() kilitsiz değildir: paylaşılan işaretçi kısa bir mutex altında
+ * kopyalanır (sadece işaretçi ve referans sayacı; çizelge kopyası ve eski
+ * çizelgenin serbest bırakılması kilit dışında yapılır). Sık yoklayan
+ * okuyucular loadIfNewer() ile sürüm değişmedikçe kilide hiç dokunmaz.
+ */
+class BestSolutionSlot {
+private:
+    mutable std::mutex mutex_;                 // Sadece schedule_ işaretçisini korur
+    std::shared_ptr<const Schedule> schedule_;
+    std::atomic<int> makespan_{-1};
+    std::atomic<unsigned> version_{0};
+
+public:
+    /**
+     * Çizelge mevcut en iyiden iyiyse yayımlar.
+     *
+     * @param schedule Çözülmüş çizelge (kopyalanır)
+     * @param makespan Çizelgenin makespan'ı
+     * @return Yayımlandıysa true
+     */
+    bool offer(const Schedule& schedule, int makespan);
+
+    std::shared_ptr<const Schedule> load() const;
+
+    /**
+     * Sürüm seenVersion'dan farklıysa son çizelgeyi yükler ve seenVersion'ı günceller.
+     *
+     * @param seenVersion Okuyucunun en son gördüğü sürüm (başlangıçta 0)
+     * @return Yeni çizelge; değişiklik yoksa nullptr (kilit alınmaz)
+     */
+    std::shared_ptr<const Schedule> loadIfNewer(unsigned& seenVersion) const;
+
+    int makespan() const { return makespan_.load(std::memory_order_acquire); }  // -1: henüz yok
+    unsigned version() const { return version_.load(std::memory_order_acquire); } // Yayım sayısı
+};
+
+/**
+ * Anytime aramanın iyileştirme aşamasında kullandığı motor.
+ */
+enum class AnytimeEngine {
+    Tabu,       // TabuSearch (N6)
+    Annealing   // SimulatedAnnealing (süre tabanlı soğutma)
+};
+
+/**
+ * AnytimeUpdate: Her yeni en iyi çözümde geri çağrıya verilen bilgi.
+ * schedule sadece çağrı süresince geçerlidir.
+ */
+struct AnytimeUpdate {
+    const Schedule& schedule;
+    int makespan;
+    double seconds;        // Başlangıçtan beri geçen süre
+    const char* source;    // Kural adı veya "Tabu" / "Annealing"
+};
+
+/**
+ * AnytimeOptions: Anytime çözme ayarları.
+ */
+struct AnytimeOptions {
+    double timeLimitSeconds = 2.0;     // Son tarih (başlangıçtan itibaren); <= 0: iptal edilene kadar
+    CancellationToken cancel;          // İptal edilince en iyi çözümle dön
+    AnytimeEngine engine = AnytimeEngine::Tabu;
+    int targetMakespan = -1;           // Bu değere ulaşılınca dur (< 0: yok)
+    unsigned seed = 1;
+    BestSolutionSlot* slot = nullptr;  // Varsa her iyileşme buraya yayımlanır
+    // Her iyileşmede çözücü iş parçacığında çağrılır; kısa tutulmalıdır
+    std::function<void(const AnytimeUpdate& update)> onImprovement;
+};
+
+/**
+ * Aramanın neden durduğu.
+ */
+enum class AnytimeStop {
+    Deadline,
+    Cancelled,
+    TargetReached,
+    LowerBoundReached, // Makespan alt sınıra eşit: çözüm optimal
+    Exhausted      // Motor kendi başına bitti (ör. kanıtlanmış optimal)
+};
+
+/**
+ * AnytimeResult: Anytime çözmenin sonucu.
+ */
+struct AnytimeResult {
+    Schedule best;
+    int bestMakespan = -1;
+    std::string bestSource;
+    double firstSolutionSeconds = -1.0;  // İlk geçerli çözümün yayımlandığı an
+    double wallSeconds = 0.0;
+    int improvements = 0;                // Yayımlanan iyileşme sayısı
+    AnytimeStop stop = AnytimeStop::Exhausted;
+    int lowerBound = -1;                 // LowerBounds::best
+
+    double gapPercent() const { return LowerBounds::gapPercent(bestMakespan, lowerBound); }
+};
+
+/**
+ * AnytimeSolver: Son tarih ve iptal ile kesilebilen, iyileşmeleri yayımlayan çözücü.
+ *
+ * Aşamalar:
+ * 1. Dağıtım kuralları ucuzdan pahalıya çalıştırılır; ilk geçerli çizelge
+ *    milisaniyeler içinde yayımlanır.
+ * 2. Kalan sürede en iyi çizelgeden seçili motor çalışır; her yeni en iyi
+ *    anında yayımlanır.
+ *
+ * Makespan alt sınıra ulaşınca iki aşama da durur. Son tarih ve iptal bayrağı
+ * motorların süre kontrolleriyle aynı aralıkta okunur (tabu: her iterasyonda,
+ * tavlama: 64 iterasyonda bir). Her durumda dönen çizelge geçerlidir.
+ */
+class AnytimeSolver {
+private:
+    const ProblemInstance& instance_;
+
+public:
+    /**
+     * @param instance Problem örneği
+     */
+    explicit AnytimeSolver(const ProblemInstance& instance);
+
+    /**
+     * Çağıran iş parçacığında çözer (son tarih, iptal veya hedefe kadar).
+     *
+     * @param options Ayarlar
+     * @return En iyi çizelge ve durma nedeni
+     */
+    AnytimeResult solve(const AnytimeOptions& options = AnytimeOptions()) const;
+
+    /**
+     * Ayrı bir iş parçacığında çözer. Bu nesne, örnek ve options.slot sonuç alınana
+     * kadar yaşamalıdır.
+     *
+     * @param options Ayarlar (kopyalanır)
+     * @return Sonuç için future
+     */
+    std::future<AnytimeResult> solveAsync(AnytimeOptions options) const;
+};
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "Models.h"
+#include "ThreadPool.h"
+
+/**
+ * BatchEvaluator: Aynı örnek için çok sayıda aday makine sırasının makespan'ını
+ * tek çağrıda hesaplar (decode + calculate yerine).
+ *
+ * Aday biçimi: her aday numOps() uzunluğunda düz bir dizidir; makine m'nin sırası
+ * [machineBegin(m), machineBegin(m + 1)) aralığındadır (tam bir Schedule::sequence
+ * ile aynı düzen). N aday art arda N * numOps() tamsayı olarak verilir.
+ *
+ * Sadece makespan hesaplanır: Schedule nesnesi kurulmaz, zamanlar yazılmaz.
+ * Çözme ScheduleDecoder ile aynı topolojik geçiştir; işçi başına geçici alan
+ * çağrılar arasında tekrar kullanılır. Geçersiz adaylar (yanlış makine,
+ * tekrarlanan işlem, döngü) için makespan -1'dir.
+ */
+class BatchEvaluator {
+private:
+    const ProblemInstance& instance_;
+    std::vector<int> machineStart_;   // Sabit makine bölüm sınırları (numMachines + 1)
+    std::vector<int> jobPredCount_;   // op -> iş öncülü varsa 1
+
+    // İşçi başına tekrar kullanılan geçici alan
+    struct Scratch {
+        std::vector<int> position;
+        std::vector<int> seenStamp;
+        std::vector<int> inDegree;
+        std::vector<int> start;
+        std::vector<int> ready;
+        int stamp = 0;
+    };
+    std::shared_ptr<ThreadPool> pool_;
+    mutable std::vector<Scratch> workers_;
+
+    int evaluateOne(const int* sequence, Scratch& scratch) const;
+
+    // sequences[i] == nullptr olan adaylar geçersiz sayılır
+    void evaluateAll(const std::vector<const int*>& sequences, int* makespans) const;
+
+public:
+    /**
+     * @param instance Problem örneği (compile edilmiş düzen kullanılır)
+     */
+    explicit BatchEvaluator(const ProblemInstance& instance);
+
+    /**
+     * Değerlendirme için iş parçacığı sayısını ayarlar. Adaylar işçilere ardışık
+     * parçalar halinde bölünür; sonuçlar iş parçacığı sayısından bağımsızdır.
+     * Aynı nesne aynı anda birden fazla iş parçacığından kullanılmamalıdır.
+     *
+     * @param threads İş parçacığı sayısı (1: seri, varsayılan; <= 0: tüm çekirdekler)
+     */
+    void setThreadCount(int threads);
+
+    int threadCount() const { return pool_ ? pool_->size() : 1; }
+
+    int numOps() const { return instance_.compiled().numOps(); }
+    int machineBegin(int m) const { return machineStart_[m]; }
+
+    /**
+     * @param sequences count * numOps() işlem id'si (aday başına makine sıraları)
+     * @param count Aday sayısı
+     * @param makespans count elemanlı çıktı; geçersiz adaylar için -1
+     */
+    void evaluate(const int* sequences, int count, int* makespans) const;
+
+    /**
+     * @param sequences Art arda aday dizileri (boyutu numOps()'un katı olmalı,
+     *                  aksi halde std::runtime_error)
+     * @return Aday başına makespan (-1: geçersiz)
+     */
+    std::vector<int> evaluate(const std::vector<int>& sequences) const;
+
+    /**
+     * Tam sıralanmış çizelgeleri değerlendirir (sequence alanları kullanılır,
+     * çizelgeler değiştirilmez). Bu örneğe ait olmayan veya eksik sıralı
+     * çizelgeler için -1.
+     *
+     * @param schedules Aday çizelgeler
+     * @return Aday başına makespan
+     */
+    std::vector<int> evaluate(const std::vector<Schedule>& schedules) const;
+};
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include "Models.h"
+
+/**
+ * Literatürdeki bir örnek için bilinen sınırlar.
+ */
+struct KnownBounds {
+    int lowerBound = -1;   // -1: bilinmiyor
+    int upperBound = -1;   // En iyi bilinen çözüm (optimal ise lowerBound ile eşit)
+};
+
+/**
+ * BenchmarkInstance: Yüklenen bir standart örnek ve (varsa) dosyadaki sınırlar.
+ */
+struct BenchmarkInstance {
+    std::string name;        // Dosya adı (uzantısız), örn. "ft10", "ta01"
+    ProblemInstance instance;
+    KnownBounds bounds;      // Sadece Taillard başlığı sınır içeriyorsa dolu
+};
+
+/**
+ * BenchmarkLoader: OR-Library ve Taillard metin biçimlerindeki standart
+ * iş atölyesi örneklerini okur.
+ *
+ * - OR-Library (ft06, ft10, la01–la40, ...): isteğe bağlı açıklama satırları,
+ *   "işler makineler" satırı, ardından her iş için "makine süre" çiftleri
+ *   (makineler 0'dan başlar).
+ * - Taillard (ta01–ta80): "Times" ve "Machines" bölümleri (makineler 1'den
+ *   başlar); başlıktaki üst/alt sınırlar okunur. JSPLIB gibi OR-Library
+ *   biçimine çevrilmiş Taillard dosyaları da OR-Library olarak okunur.
+ *
+ * İş ve makine id'leri sıfırla doldurulmuş indekslerdir ("J03", "M07"), böylece
+ * yoğun indeksler dosyadaki sırayla aynıdır. Hatalarda std::runtime_error fırlatır.
+ */
+class BenchmarkLoader {
+public:
+    /**
+     * Biçimi içeriğe göre seçerek yükler ("Times" bölümü varsa Taillard).
+     *
+     * @param filePath Örnek dosyası
+     * @return Yüklenen örnek (compile edilmiş)
+     */
+    static BenchmarkInstance load(const std::string& filePath);
+
+    static BenchmarkInstance loadOrLibrary(const std::string& filePath);
+    static BenchmarkInstance loadTaillard(const std::string& filePath);
+
+    /**
+     * Sınır dosyasını okur. Her satır: "ad alt_sınır üst_sınır" veya "ad optimal";
+     * '#' ile başlayan satırlar açıklamadır.
+     *
+     * @param filePath Sınır dosyası
+     * @return ad -> sınırlar
+     */
+    static std::unordered_map<std::string, KnownBounds> loadBounds(const std::string& filePath);
+
+    /**
+     * Yerleşik tablo: ft06, ft10, ft20 ve la01–la40 için kanıtlanmış optimal değerler.
+     * Diğer örnekler (ör. Taillard) için sınırlar dosyadan okunmalıdır.
+     *
+     * @param name Örnek adı
+     * @return Sınırlar; bilinmiyorsa her ikisi -1
+     */
+    static KnownBounds builtinBounds(const std::string& name);
+};
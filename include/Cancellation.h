@@ -0,0 +1,23 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+/**
+ * CancellationToken: İşbirlikçi iptal bayrağı.
+ *
+ * Kopyalar aynı bayrağı paylaşır: çözücüye bir kopya verilir, çağıran (ör.
+ * operatör "onayla" dediğinde UI iş parçacığı) kendi kopyasıyla cancel()
+ * çağırır. Çözücüler bayrağı süre kontrolleriyle aynı aralıkta okur ve o
+ * ana kadarki en iyi çözümle temiz bir şekilde döner.
+ */
+class CancellationToken {
+private:
+    std::shared_ptr<std::atomic<bool>> flag_;
+
+public:
+    CancellationToken() : flag_(std::make_shared<std::atomic<bool>>(false)) {}
+
+    void cancel() const { flag_->store(true, std::memory_order_relaxed); }
+    bool isCancelled() const { return flag_->load(std::memory_order_relaxed); }
+};
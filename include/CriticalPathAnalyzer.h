@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Models.h"
+#include "ScheduleDecoder.h"
+#include <vector>
+
+/**
+ * CriticalBlock: Kritik yol üzerinde aynı makinede art arda çalışan işlemler.
+ * begin/end, Schedule::sequence içindeki (dahil) indekslerdir.
+ */
+struct CriticalBlock {
+    int machine = -1;
+    int begin = -1;
+    int end = -1;
+
+    int size() const { return end - begin + 1; }
+};
+
+/**
+ * CriticalPathAnalysis: Çözülmüş bir çizelgenin kritik yol ve gevşeklik (slack) analizi.
+ */
+struct CriticalPathAnalysis {
+    int makespan = -1;
+    std::vector<int> path;             // Kritik yol işlemleri (başlangıçtan sona)
+    std::vector<CriticalBlock> blocks; // Yol sırasıyla bloklar (tek işlemli olanlar dahil)
+    std::vector<int> tails;            // İşlem başına kuyruk (kendi süresi hariç)
+    std::vector<int> totalSlack;       // makespan - (baş + süre + kuyruk); sıralanmamış: -1
+    std::vector<int> freeSlack;        // Ardılların en erken başlangıcına kadar boşluk; sıralanmamış: -1
+
+    // Makespan'ı değiştirmeden geciktirilemeyen işlem mi?
+    bool isCritical(int op) const { return totalSlack[op] == 0; }
+};
+
+/**
+ * CriticalPathAnalyzer: Çözülmüş çizelge üzerinde kritik yol analizi.
+ *
+ * İleri geçiş çözücünün hesapladığı baş değerleridir (startTime); geri geçiş
+ * ScheduleDecoder::computeTails ile kuyrukları hesaplar. Her ikisi de O(işlem).
+ * - Toplam gevşeklik: makespan - (baş + süre + kuyruk); 0 ise işlem kritiktir
+ * - Serbest gevşeklik: işlemin, hiçbir ardılını geciktirmeden kayabileceği süre
+ *
+ * Kritik bloklar komşuluk üretiminde kullanılır: makespan'ı azaltabilecek her
+ * hamle, izlenen kritik yoldaki bir blok içinde bir sırayı ters çevirmelidir.
+ */
+class CriticalPathAnalyzer {
+public:
+    /**
+     * Tam analiz: kritik yol, bloklar, toplam ve serbest gevşeklik.
+     *
+     * @param schedule Çözülmüş çizelge
+     * @param instance Problem örneği
+     * @return Analiz; çizelge çözülmemişse makespan = -1 ve diziler boş
+     */
+    static CriticalPathAnalysis analyze(const Schedule& schedule, const ProblemInstance& instance);
+
+    /**
+     * Sadece kritik yolu ve bloklarını izler (kuyruk gerekmez, O(yol uzunluğu)).
+     * Yol makespan işleminden geriye doğru izlenir; sıkı makine öncülü tercih
+     * edilir, böylece bloklar mümkün olduğunca uzun olur.
+     *
+     * @param schedule Çözülmüş çizelge
+     * @param instance Problem örneği
+     * @param path Çıktı: kritik yol işlemleri (temizlenip doldurulur)
+     * @param blocks Çıktı: yol sırasıyla bloklar (temizlenip doldurulur)
+     */
+    static void tracePath(const Schedule& schedule, const ProblemInstance& instance,
+                          std::vector<int>& path, std::vector<CriticalBlock>& blocks);
+};
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Models.h"
+#include <algorithm>
+#include <vector>
+
+/**
+ * Dağıtım kuralları (dispatch rules): Giffler–Thompson üretecinde çatışma
+ * kümesinden hangi işlemin seçileceğini belirleyen küçük fonktorlar.
+ *
+ * Her kural bir anahtar döndürür: key(ctx, op). Küçük anahtar önceliklidir;
+ * eşitlikte küçük işlem id'si kazanır. Kurallar şablon parametresi olarak
+ * verilir, böylece iç döngüde sanal çağrı olmaz. Yeni bir kural için sadece
+ * key() tanımlayan bir struct yeterlidir.
+ */
+
+/**
+ * DispatchContext: Kuralların okuyabileceği üretim durumu.
+ */
+struct DispatchContext {
+    const CompiledInstance& ci;
+    const std::vector<int>& jobReady;      // iş -> sıradaki işlemin hazır olduğu zaman
+    const std::vector<int>& machineReady;  // makine -> makinenin boşalacağı zaman
+
+    int earliestStart(int op) const {
+        int jr = jobReady[ci.opJob[op]];
+        int mr = machineReady[ci.opMachine[op]];
+        return jr > mr ? jr : mr;
+    }
+
+    // İşte bu işlem dahil kalan işlem sayısı
+    int opsRemaining(int op) const {
+        return ci.jobOffset[ci.opJob[op] + 1] - op;
+    }
+};
+
+// SPT (Shortest Processing Time): en kısa işlem süresi
+struct SPTRule {
+    int key(const DispatchContext& ctx, int op) const { return ctx.ci.opDuration[op]; }
+};
+
+// LPT (Longest Processing Time): en uzun işlem süresi
+struct LPTRule {
+    int key(const DispatchContext& ctx, int op) const { return -ctx.ci.opDuration[op]; }
+};
+
+// FCFS (First Come First Served): kuyruğa (makineye hazır) ilk gelen işlem
+struct FCFSRule {
+    int key(const DispatchContext& ctx, int op) const { return ctx.jobReady[ctx.ci.opJob[op]]; }
+};
+
+// MWKR (Most Work Remaining): işinde en çok kalan işlem süresi
+struct MWKRRule {
+    int key(const DispatchContext& ctx, int op) const { return -ctx.ci.remainingWork[op]; }
+};
+
+// LWKR (Least Work Remaining): işinde en az kalan işlem süresi
+struct LWKRRule {
+    int key(const DispatchContext& ctx, int op) const { return ctx.ci.remainingWork[op]; }
+};
+
+// MOR (Most Operations Remaining): işinde en çok kalan işlem sayısı
+struct MORRule {
+    int key(const DispatchContext& ctx, int op) const { return -ctx.opsRemaining(op); }
+};
+
+// LJF (Longest Job First): en uzun toplam işlem süresine sahip iş
+struct LJFRule {
+    int key(const DispatchContext& ctx, int op) const {
+        return -ctx.ci.jobTotalTime[ctx.ci.opJob[op]];
+    }
+};
+
+// Önce toplam gevşekliği küçük (kritik yola yakın) işlemler, aralarında SPT.
+// Gevşeklikler bir referans çizelgeden alınır (bkz. CriticalPathAnalyzer).
+struct SlackRule {
+    const std::vector<int>* slack = nullptr;
+
+    long long key(const DispatchContext& ctx, int op) const {
+        long long s = std::max(0, (*slack)[op]);
+        return (s << 32) + ctx.ci.opDuration[op];
+    }
+};
+
+/**
+ * Bileşik ağırlıklı kural: işlem süresi, kalan iş, kalan işlem sayısı ve
+ * en erken başlangıcın doğrusal birleşimi. Varsayılan ağırlıklar SPT ile
+ * MWKR'yi dengeler.
+ */
+struct CompositeRule {
+    double wProcessing = 1.0;
+    double wRemainingWork = 0.5;
+    double wOpsRemaining = 0.0;
+    double wEarliestStart = 0.0;
+
+    double key(const DispatchContext& ctx, int op) const {
+        return wProcessing * ctx.ci.opDuration[op]
+             - wRemainingWork * ctx.ci.remainingWork[op]
+             - wOpsRemaining * ctx.opsRemaining(op)
+             + wEarliestStart * ctx.earliestStart(op);
+    }
+};
+
+/**
+ * Dışarıdan verilen öncelik listesi: priority[op] küçük olan önce seçilir.
+ * Genetik algoritmanın kromozomları (gen konumu) ve makine sıraları (sıradaki
+ * indeks) bu kuralla en yakın aktif çizelgeye çözülür.
+ */
+struct PriorityListRule {
+    const std::vector<int>* priority = nullptr;
+
+    int key(const DispatchContext&, int op) const { return (*priority)[op]; }
+};
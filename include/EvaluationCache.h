@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * EvaluationCacheStats: Önbellek sayaçlarının anlık görüntüsü.
+ */
+struct EvaluationCacheStats {
+    long long lookups = 0;
+    long long hits = 0;        // Her isabet bir çözme (decode) tasarrufudur
+    long long inserts = 0;
+    long long evictions = 0;   // Dolu bir yuvanın başka bir özetle ezilmesi
+
+    double hitRate() const { return lookups > 0 ? static_cast<double>(hits) / lookups : 0.0; }
+};
+
+/**
+ * EvaluationCache: Makine sırası özetinden (ScheduleHash) makespan'a sınırlı önbellek.
+ *
+ * Yerel arama ve meta-sezgiler aynı sıralara tekrar tekrar döner (ör. A/B
+ * swap'ının ardından B/A); önbellek bu komşuların yeniden çözülmesini önler.
+ * Uygulanamayan (döngülü) sıralar makespan -1 ile saklanır.
+ *
+ * Anahtar sadece 64 bitlik özettir; iki farklı sıra aynı özeti verirse isabet
+ * başka bir sıranın makespan'ını döndürür. Kullanıcılar isabeti sadece adayları
+ * sıralamak için kullanır ve bir hamleyi kabul ederken onu uygulayıp çözülen
+ * değerle karşılaştırır; uyuşmazsa kaydı düzeltip hamleyi reddeder. Böylece
+ * çakışma hiçbir zaman kötü bir hamlenin kabulüne veya yanlış bir makespan'a
+ * yol açmaz, ama yakalanana kadar arama yörüngesini değiştirebilir (ör. iyi bir
+ * komşuyu kötü görünen bir kayıt gizleyebilir).
+ *
+ * Kapasite sabittir: özet doğrudan bir yuvaya eşlenir, çakışan yeni kayıt eskisini
+ * ezer. Yuvalar kilitli parçalara (shard) bölünür, böylece aynı önbellek birden
+ * fazla iş parçacığı ve çözücü tarafından paylaşılabilir. Önbellek tek bir
+ * problem örneğine aittir; başka bir örnekle kullanılmadan önce clear() çağrılmalıdır.
+ */
+class EvaluationCache {
+private:
+    struct Entry {
+        std::uint64_t hash = 0;
+        int makespan = 0;
+        bool used = false;
+    };
+
+    struct Shard {
+        std::mutex mutex;
+        std::vector<Entry> entries;
+    };
+
+    static constexpr int kShardBits = 6;
+    static constexpr std::size_t kShards = std::size_t(1) << kShardBits;
+
+    std::unique_ptr<Shard[]> shards_;
+    std::size_t slotsPerShard_;
+
+    mutable std::atomic<long long> lookups_{0};
+    mutable std::atomic<long long> hits_{0};
+    std::atomic<long long> inserts_{0};
+    std::atomic<long long> evictions_{0};
+
+    Shard& shardOf(std::uint64_t hash) const {
+        return shards_[hash & (kShards - 1)];
+    }
+    std::size_t slotOf(std::uint64_t hash) const { return (hash >> kShardBits) % slotsPerShard_; }
+
+public:
+    /**
+     * @param capacity Yaklaşık kayıt sayısı (parça sayısının katına yuvarlanır)
+     */
+    explicit EvaluationCache(std::size_t capacity = std::size_t(1) << 20);
+
+    /**
+     * Özeti arar.
+     *
+     * @param hash Makine sırası özeti
+     * @param makespan Bulunursa saklanan makespan (-1: döngülü)
+     * @return Bulunduysa true
+     */
+    bool lookup(std::uint64_t hash, int& makespan) const;
+
+    /**
+     * Bir değerlendirmeyi saklar (yuva doluysa eskisini ezer).
+     *
+     * @param hash Makine sırası özeti
+     * @param makespan Makespan; döngülü sıra için -1
+     */
+    void insert(std::uint64_t hash, int makespan);
+
+    // Tüm kayıtları ve sayaçları siler
+    void clear();
+
+    std::size_t capacity() const { return slotsPerShard_ * kShards; }
+
+    EvaluationCacheStats stats() const;
+};
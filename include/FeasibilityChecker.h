@@ -1,23 +1,84 @@
 #pragma once
 
+#include <string>
+#include <vector>
 #include "Models.h"
 
+/**
+ * Uygulanabilirlik ihlali türleri.
+ */
+enum class ViolationKind {
+    LayoutMismatch,    // Çizelge bu örneğin yoğun düzenine ait değil
+    Precedence,        // İşlem, iş öncülü bitmeden başlıyor
+    MachineOverlap,    // Aynı makinede ardışık iki işlem çakışıyor
+    WrongMachine,      // İşlem başka bir makinenin sırasında
+    MissingOperation   // Sıralanmış ya da kısmen çizelgelenmiş bir işin işleminin zamanı yok
+};
+
+/**
+ * Tek bir ihlal; işlemler yoğun op id'leridir (-1: ilgisiz).
+ * - Precedence: op = işlem, otherOp = iş öncülü
+ * - MachineOverlap: op = sonraki işlem, otherOp = makinede önceki işlem
+ * - WrongMachine: op = işlem, machine = bulunduğu sıranın makinesi
+ * - MissingOperation: op = zamanı olmayan işlem
+ */
+struct Violation {
+    ViolationKind kind = ViolationKind::LayoutMismatch;
+    int op = -1;
+    int otherOp = -1;
+    int machine = -1;
+};
+
+/**
+ * FeasibilityChecker::diagnose sonucu: bulunan tüm ihlaller.
+ */
+struct FeasibilityReport {
+    std::vector<Violation> violations;
+
+    bool feasible() const { return violations.empty(); }
+};
+
 /**
  * FeasibilityChecker: Bir çizelgenin uygulanabilir olup olmadığını doğrular.
- * 
+ *
  * Kontroller:
  * - İş önceliği: Aynı işin işlemleri sıraya uymalı
  * - Makine kısıtı: Aynı makinede çakışan aralıklar olmamalı
+ *
+ * Yoğun diziler üzerinde doğrusal geçiştir: işlemler bir kez (iş öncülü ile),
+ * makine sıraları bir kez (sıradaki önceki işlem ile) taranır; geçici bellek
+ * ayrılmaz. isValid ilk ihlalde durur, diagnose hepsini toplar.
  */
 class FeasibilityChecker {
 public:
     /**
      * Bir çizelgenin uygulanabilir olup olmadığını kontrol eder.
-     * 
+     *
      * @param schedule Doğrulanacak çizelge (opTimes doldurulmuş olmalı)
      * @param instance Doğrulama için problem örneği
      * @return çizelge geçerliyse true, aksi halde false
      */
     static bool isValid(const Schedule& schedule, const ProblemInstance& instance);
-};
 
+    /**
+     * isValid ile aynı kontroller, ama tüm ihlalleri ilgili işlemlerle döndürür.
+     * Düzen uyuşmazlığında tek bir LayoutMismatch ihlali döner.
+     *
+     * @param schedule Doğrulanacak çizelge
+     * @param instance Problem örneği
+     * @return İhlal raporu (boşsa çizelge geçerlidir)
+     */
+    static FeasibilityReport diagnose(const Schedule& schedule, const ProblemInstance& instance);
+
+    /**
+     * Bir ihlalin okunabilir açıklaması, örn.
+     * "precedence: J1#1 starts at 3 before J1#0 ends at 5".
+     *
+     * @param violation İhlal
+     * @param schedule İhlalin bulunduğu çizelge (zamanlar için)
+     * @param instance Problem örneği (id'ler için)
+     * @return Açıklama
+     */
+    static std::string describe(const Violation& violation, const Schedule& schedule,
+                                const ProblemInstance& instance);
+};
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Models.h"
+#include "Heuristics.h"
+#include "LocalSearch.h"
+#include "LowerBounds.h"
+#include <memory>
+#include <vector>
+
+/**
+ * Genetik algoritmanın çaprazlama operatörü.
+ */
+enum class GeneticCrossover {
+    POX,  // Precedence Operation crossover: seçili işlerin genleri 1. ebeveyndeki
+          // konumlarında kalır, kalanlar 2. ebeveyndeki sırayla doldurulur
+    JOX   // Job-based Order crossover: aynı işlem makine sıraları üzerinde yapılır;
+          // çocuk sıralar Giffler–Thompson ile en yakın aktif çizelgeye onarılır
+};
+
+/**
+ * GeneticOptions: Genetik algoritma ayarları.
+ */
+struct GeneticOptions {
+    int populationSize = 50;
+    int generations = 200;              // Nesil sınırı
+    double timeLimitSeconds = 0.0;      // <= 0: süre sınırı yok
+    GeneticCrossover crossover = GeneticCrossover::POX;
+    double crossoverRate = 0.9;         // Aksi halde çocuk 1. ebeveynin kopyasıdır
+    double mutationRate = 0.2;          // Çocuk başına swap veya ekleme mutasyonu olasılığı
+    int tournamentSize = 2;
+    int eliteCount = 2;                 // Sonraki nesle değişmeden geçen en iyi birey sayısı
+    bool memetic = false;               // Her nesilde en iyi yeni bireyleri LocalSearch ile cilala
+    int memeticCount = 2;               // Nesil başına cilalanan birey sayısı
+    int memeticIterations = 50;         // Cilalama başına LocalSearch iterasyon sınırı
+    std::shared_ptr<EvaluationCache> cache; // Cilalamada paylaşılan komşu önbelleği (nullptr: kapalı)
+    bool seedWithRules = true;          // Başlangıç nüfusuna dağıtım kuralı çizelgelerini ekle
+    int threads = 0;                    // Uygunluk değerlendirmesi için; <= 0: tüm çekirdekler
+    int targetMakespan = -1;            // Bu değere ulaşılınca dur (< 0: yok)
+    unsigned seed = 1;
+};
+
+/**
+ * GeneticResult: Genetik algoritmanın sonucu.
+ */
+struct GeneticResult {
+    Schedule best;
+    int bestMakespan = -1;
+    int generations = 0;            // Tamamlanan nesil sayısı
+    long long evaluations = 0;      // Çözülen kromozom sayısı
+    double wallSeconds = 0.0;
+    int lowerBound = -1;           // LowerBounds::best; bestMakespan buna eşitse optimal
+
+    double gapPercent() const { return LowerBounds::gapPercent(bestMakespan, lowerBound); }
+};
+
+/**
+ * GeneticAlgorithm: İşlem tabanlı kodlama (tekrarlı permütasyon) ile nüfus tabanlı çözücü.
+ *
+ * Kromozom numOps uzunluğunda iş indeksleri dizisidir; iş j tam jobLength(j)
+ * kez geçer ve k. geçişi işin k. işlemidir. Böylece her kromozom iş sırasını
+ * korur. Kromozomlar, gen konumu öncelik olarak kullanılarak Giffler–Thompson
+ * üreteciyle aktif çizelgelere çözülür (bkz. PriorityListRule).
+ *
+ * Yeni nesil seri olarak (tek rastgele üreteçle) üretilir, sonra tüm çocuklar
+ * iş parçacığı havuzunda paralel çözülür; sonuç iş parçacığı sayısından
+ * bağımsızdır (süre sınırı hariç). Memetik modda cilalanan bireylerin
+ * kromozomları iyileştirilmiş çizelgeden yeniden kodlanır (Lamarck). En iyi
+ * birey alt sınıra (LowerBounds) ulaşınca arama durur.
+ */
+class GeneticAlgorithm {
+private:
+    const ProblemInstance& instance_;
+    DispatchHeuristics heuristics_;
+
+public:
+    /**
+     * @param instance Problem örneği
+     */
+    explicit GeneticAlgorithm(const ProblemInstance& instance);
+
+    /**
+     * Bir kromozomu aktif çizelgeye çözer.
+     *
+     * @param chromosome Tekrarlı permütasyon (iş indeksleri)
+     * @return Çözülmüş çizelge
+     */
+    Schedule decode(const std::vector<int>& chromosome) const;
+
+    /**
+     * Çözülmüş bir çizelgeyi kromozoma çevirir: işlemler başlangıç zamanına göre
+     * sıralanır (eşitlikte küçük işlem id'si). Aktif bir çizelgenin kodu aynı
+     * çizelgeye çözülür.
+     *
+     * @param schedule Çözülmüş çizelge
+     * @return Kromozom
+     */
+    std::vector<int> encode(const Schedule& schedule) const;
+
+    /**
+     * Genetik algoritmayı çalıştırır.
+     *
+     * @param options Ayarlar
+     * @return En iyi çizelge ve istatistikler
+     */
+    GeneticResult run(const GeneticOptions& options = GeneticOptions()) const;
+};
@@ -4,30 +4,81 @@
 #include "ScheduleDecoder.h"
 #include "MakespanCalculator.h"
 #include "FeasibilityChecker.h"
+#include "DispatchRules.h"
+#include "CriticalPathAnalyzer.h"
+#include <climits>
+#include <functional>
+#include <queue>
+#include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
-#include <unordered_map>
 
 /**
  * DispatchHeuristics: Farklı dağıtım sezgileri kullanarak başlangıç çizelgeleri oluşturur.
  * 
- * Desteklenen sezgiler:
+ * Desteklenen sezgiler (bkz. DispatchRules.h):
  * - SPT (Shortest Processing Time): En kısa işlem süresine sahip işlemleri önceliklendirir
+ * - LPT (Longest Processing Time): En uzun işlem süresine sahip işlemleri önceliklendirir
+ * - FCFS (First Come First Served): Makineye ilk hazır olan işlemi önceliklendirir
+ * - MWKR / LWKR: İşinde en çok / en az iş kalan işlemi önceliklendirir
+ * - MOR: İşinde en çok işlem kalan işlemi önceliklendirir
  * - LJF (Longest Job First): En uzun toplam işlem süresine sahip işleri önceliklendirir
+ * - Composite: Ağırlıklı bileşik kural
  * - Critical Path Priority: Kritik yoldaki işlemleri önceliklendirir
+ *
+ * Tüm sezgiler aynı olay güdümlü Giffler–Thompson üretecini kullanır ve aktif
+ * çizelge üretir: her adımda en erken bitebilecek işlemin makinesi seçilir,
+ * o makinede bu bitişten önce başlayabilecek işlemler (çatışma kümesi)
+ * arasından kurala göre biri çizelgelenir. Üreteç kural tipine göre derleme
+ * zamanında özelleştirilir.
  */
 class DispatchHeuristics {
+public:
+    /**
+     * Çalışma zamanında seçilebilen hazır kurallar.
+     */
+    enum class Rule {
+        SPT,
+        LPT,
+        FCFS,
+        MWKR,
+        LWKR,
+        MOR,
+        LJF,
+        Composite,
+        CriticalPath
+    };
+
+    // Tüm hazır kurallar (portföy ve kıyaslamalar için)
+    static const std::vector<Rule>& allRules();
+
+    // Kuralın kısa adı ("SPT", "MWKR", ...)
+    static const char* ruleName(Rule rule);
+
 private:
     const ProblemInstance& instance_;
-    
-    // Yardımcı fonksiyonlar
-    std::vector<OpKey> getReadyOperations(
-        const std::unordered_map<std::string, int>& scheduledOpCount,
-        const std::string& machineId) const;
-    
-    int getJobTotalTime(const std::string& jobId) const;
+
+    /**
+     * Giffler–Thompson aktif çizelge üreteci.
+     * Makine başına hazır işlem kümeleri artımlı tutulur; makineler en erken
+     * bitiş zamanlarına göre bir öncelik kuyruğunda bekler. Bu kısım toplamda
+     * O(N log N)'dir (N: işlem sayısı).
+     *
+     * Çatışma kümesi ise her adımda seçilen makinenin hazır işlemleri taranarak
+     * kurulur: kural anahtarı zamana bağlı olabildiği için önceden sıralanamaz.
+     * Bir makinede aynı anda en fazla iş sayısı (J) kadar hazır işlem olduğundan
+     * toplam karmaşıklık en kötü durumda O(N·J)'dir; rotalar makinelere dengeli
+     * dağılmışsa adım başına taranan küme ortalama J/M civarındadır.
+     * 
+     * @param rule Anahtarı küçük olan işlem seçilir (eşitlikte küçük işlem id'si)
+     * @return Makine başına işlem sıraları
+     */
+    template <typename DispatchRule>
+    std::vector<std::vector<int>> generateActiveSequences(const DispatchRule& rule) const;
     
     Schedule buildScheduleFromMachineSequences(
-        const std::unordered_map<std::string, std::vector<OpKey>>& machineSequences) const;
+        const std::vector<std::vector<int>>& machineSequences) const;
 
 public:
     /**
@@ -37,13 +88,46 @@ public:
      */
     explicit DispatchHeuristics(const ProblemInstance& instance);
 
+    /**
+     * Verilen kural fonktoru ile (derleme zamanında özelleştirilmiş) çizelge oluşturur.
+     * 
+     * @param rule key(const DispatchContext&, int op) tanımlayan kural
+     * @return Oluşturulan (çözülmüş) çizelge
+     */
+    template <typename DispatchRule>
+    Schedule buildSchedule(const DispatchRule& rule = DispatchRule()) const {
+        return buildScheduleFromMachineSequences(generateActiveSequences(rule));
+    }
+
+    /**
+     * Hazır bir kural ile çizelge oluşturur (kural seçimi döngü dışında bir kez yapılır).
+     * 
+     * @param rule Kural
+     * @return Oluşturulan çizelge
+     */
+    Schedule buildSchedule(Rule rule) const;
+
     /**
      * SPT (Shortest Processing Time) sezgisi ile çizelge oluşturur.
      * Her makinede, hazır işlemler arasından en kısa süreye sahip olanı seçer.
      * 
      * @return Oluşturulan çizelge
      */
-    Schedule buildSPTSchedule();
+    Schedule buildSPTSchedule() const;
+
+    /**
+     * LPT (Longest Processing Time) sezgisi ile çizelge oluşturur.
+     * 
+     * @return Oluşturulan çizelge
+     */
+    Schedule buildLPTSchedule() const;
+
+    /**
+     * FCFS (First Come First Served) sezgisi ile çizelge oluşturur.
+     * 
+     * @return Oluşturulan çizelge
+     */
+    Schedule buildFCFSSchedule() const;
 
     /**
      * LJF (Longest Job First) sezgisi ile çizelge oluşturur.
@@ -51,15 +135,163 @@ public:
      * 
      * @return Oluşturulan çizelge
      */
-    Schedule buildLJFSchedule();
+    Schedule buildLJFSchedule() const;
 
     /**
      * Critical Path Priority sezgisi ile çizelge oluşturur.
-     * Önce bir SPT çizelgesi oluşturur, sonra kritik yoldaki işlemleri belirler
-     * ve bunları önceliklendirerek yeni bir çizelge oluşturur.
+     * Önce bir SPT çizelgesi oluşturur, CriticalPathAnalyzer ile işlemlerin toplam
+     * gevşekliğini hesaplar ve gevşekliği küçük (kritik) işlemleri önceliklendirerek
+     * yeni bir çizelge oluşturur.
      * 
      * @return Oluşturulan çizelge
      */
-    Schedule buildCriticalPathSchedule();
+    Schedule buildCriticalPathSchedule() const;
 };
 
+template <typename DispatchRule>
+std::vector<std::vector<int>> DispatchHeuristics::generateActiveSequences(
+    const DispatchRule& rule) const {
+    const CompiledInstance& ci = instance_.compiled();
+    const int numMachines = ci.numMachines();
+
+    std::vector<std::vector<int>> machineSequences(numMachines);
+    for (int m = 0; m < numMachines; ++m) {
+        machineSequences[m].reserve(ci.machineOpCount[m]);
+    }
+
+    // İş ve makine hazır zamanları
+    std::vector<int> jobReady(ci.numJobs(), 0);
+    std::vector<int> machineReady(numMachines, 0);
+    const DispatchContext ctx{ci, jobReady, machineReady};
+
+    // Makine başına hazır işlemler: her işin sıradaki (çizelgelenmemiş) işlemi
+    std::vector<std::vector<int>> readyOps(numMachines);
+
+    // Hazır bir işlemin en erken bitişi max(iş hazır, makine hazır) + süre. İşlem
+    // beklerken iş hazır zamanı sabittir, makine zamanı ise sadece artar; bu yüzden
+    // makine başına tembel silmeli üç heap yeterlidir (geçerlilik opState ile):
+    // - pendingRelease: iş hazır zamanı makineninkinden büyük olanlar, (iş hazır, op)
+    // - pendingFinish:  aynı işlemler, (iş hazır + süre, op)
+    // - released:       makine zamanına kadar hazır olanlar, (süre, op)
+    // Makinenin en erken bitişi = min(pendingFinish tepesi, makine hazır + released tepesi).
+    enum : char { NotReady, Pending, Released, Done };
+    using Key = std::pair<int, int>;
+    using MinHeap = std::priority_queue<Key, std::vector<Key>, std::greater<Key>>;
+    std::vector<char> opState(ci.numOps(), NotReady);
+    std::vector<MinHeap> pendingRelease(numMachines);
+    std::vector<MinHeap> pendingFinish(numMachines);
+    std::vector<MinHeap> released(numMachines);
+
+    auto addReady = [&](int op) {
+        int m = ci.opMachine[op];
+        int release = jobReady[ci.opJob[op]];
+        readyOps[m].push_back(op);
+        if (release <= machineReady[m]) {
+            opState[op] = Released;
+            released[m].emplace(ci.opDuration[op], op);
+        } else {
+            opState[op] = Pending;
+            pendingRelease[m].emplace(release, op);
+            pendingFinish[m].emplace(release + ci.opDuration[op], op);
+        }
+    };
+
+    for (int j = 0; j < ci.numJobs(); ++j) {
+        if (ci.jobLength(j) > 0) {
+            addReady(ci.opId(j, 0));
+        }
+    }
+
+    // Makinelerin en erken bitiş zamanları için tembel silmeli min-heap: (bitiş, makine, sürüm)
+    using Entry = std::tuple<int, int, int>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> machineQueue;
+    std::vector<int> version(numMachines, 0);
+
+    auto refreshMachine = [&](int m) {
+        ++version[m];
+        // Makine zamanına ulaşan bekleyen işlemler serbest kalır; eski kayıtlar atılır
+        MinHeap& byRelease = pendingRelease[m];
+        while (!byRelease.empty() &&
+               (opState[byRelease.top().second] != Pending || byRelease.top().first <= machineReady[m])) {
+            int op = byRelease.top().second;
+            byRelease.pop();
+            if (opState[op] == Pending) {
+                opState[op] = Released;
+                released[m].emplace(ci.opDuration[op], op);
+            }
+        }
+        MinHeap& byFinish = pendingFinish[m];
+        while (!byFinish.empty() && opState[byFinish.top().second] != Pending) {
+            byFinish.pop();
+        }
+        MinHeap& releasedOps = released[m];
+        while (!releasedOps.empty() && opState[releasedOps.top().second] != Released) {
+            releasedOps.pop();
+        }
+
+        int best = byFinish.empty() ? INT_MAX : byFinish.top().first;
+        if (!releasedOps.empty()) {
+            best = std::min(best, machineReady[m] + releasedOps.top().first);
+        }
+        if (best != INT_MAX) {
+            machineQueue.emplace(best, m, version[m]);
+        }
+    };
+
+    for (int m = 0; m < numMachines; ++m) {
+        refreshMachine(m);
+    }
+
+    while (!machineQueue.empty()) {
+        auto [completion, m, ver] = machineQueue.top();
+        machineQueue.pop();
+        if (ver != version[m]) {
+            continue; // Eski kayıt
+        }
+
+        // Çatışma kümesi: bu makinede en erken bitişten önce başlayabilen işlemler;
+        // aralarından anahtarı en küçük (eşitlikte id'si küçük) olan seçilir
+        std::vector<int>& ready = readyOps[m];
+        size_t chosen = ready.size();
+        decltype(rule.key(ctx, 0)) chosenKey{};
+        for (size_t i = 0; i < ready.size(); ++i) {
+            int op = ready[i];
+            if (ctx.earliestStart(op) >= completion) {
+                continue;
+            }
+            auto key = rule.key(ctx, op);
+            if (chosen == ready.size() || key < chosenKey ||
+                (!(chosenKey < key) && op < ready[chosen])) {
+                chosen = i;
+                chosenKey = key;
+            }
+        }
+
+        // Seçilen işlemi çizelgele
+        int op = ready[chosen];
+        ready[chosen] = ready.back();
+        ready.pop_back();
+        opState[op] = Done;
+
+        int end = ctx.earliestStart(op) + ci.opDuration[op];
+        int job = ci.opJob[op];
+        jobReady[job] = end;
+        machineReady[m] = end;
+        machineSequences[m].push_back(op);
+
+        // İşin sıradaki işlemi kendi makinesinde hazır hale gelir
+        int next = op + 1;
+        int nextMachine = -1;
+        if (next < ci.jobOffset[job + 1]) {
+            nextMachine = ci.opMachine[next];
+            addReady(next);
+        }
+
+        refreshMachine(m);
+        if (nextMachine >= 0 && nextMachine != m) {
+            refreshMachine(nextMachine);
+        }
+    }
+
+    return machineSequences;
+}
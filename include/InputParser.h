@@ -5,6 +5,8 @@
 
 class InputParser {
 public:
-    // Throws std::runtime_error on invalid input.
+    // Streams the file through a SAX handler (no JSON DOM is built); validation
+    // runs once the root object closes, in the same order as a DOM walk.
+    // Throws std::runtime_error on invalid input, nlohmann::json::parse_error on malformed JSON.
     static ProblemInstance parseFromJsonFile(const std::string& filePath);
 };
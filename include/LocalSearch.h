@@ -4,43 +4,114 @@
 #include "ScheduleDecoder.h"
 #include "MakespanCalculator.h"
 #include "FeasibilityChecker.h"
+#include "Move.h"
+#include "CriticalPathAnalyzer.h"
+#include "ThreadPool.h"
+#include "LowerBounds.h"
+#include "EvaluationCache.h"
+#include <functional>
+#include <memory>
+#include <vector>
 
 /**
  * LocalSearch: Mevcut çizelgeleri iyileştirmek için yerel arama yapar.
  * 
  * Strateji:
- * - Makinelerdeki bitişik işlemleri değiştirir (sadece farklı işlerden olanlar)
+ * - Kritik bloklardaki bitişik işlemleri değiştirir (sadece farklı işlerden olanlar)
  * - Sadece uygulanabilir ve makespan'ı iyileştiren çizelgeleri kabul eder
+ * - Makespan alt sınıra (LowerBounds) ulaşınca durur: çizelge optimaldir
+ * - İsteğe bağlı EvaluationCache ile daha önce görülen sıralar yeniden çözülmez
  */
 class LocalSearch {
+public:
+    /**
+     * Komşu değerlendirme modu.
+     */
+    enum class EvaluationMode {
+        Incremental,       // Her aday swap artımlı olarak yeniden çözülür (varsayılan)
+        HeadTailEstimate   // Adaylar baş/kuyruk tahmini ile O(1) puanlanır,
+                           // sadece en umut verici k tanesi çözülüp doğrulanır
+    };
+
 private:
     const ProblemInstance& instance_;
+    int lowerBound_;   // Bu makespan'a ulaşan çizelge optimaldir, arama durur
+    EvaluationMode evaluationMode_ = EvaluationMode::Incremental;
+    int verifiedCandidates_ = 3;
+
+    // Paralel değerlendirme: havuz ve işçi başına çalışma çizelgesi, geri alma kaydı
+    // ve işçinin parçasındaki en iyi aday
+    struct WorkerScratch {
+        Schedule working;
+        MoveJournal journal;
+        int bestMakespan = -1;
+        int bestIndex = -1;
+    };
+    std::shared_ptr<ThreadPool> pool_;
+    mutable std::vector<WorkerScratch> workers_;
+    std::shared_ptr<EvaluationCache> cache_;
+
+    // İterasyonlar arasında tekrar kullanılan geçici alan: kararlı durumda bir
+    // arama turu (seri veya paralel) çağıran iş parçacığında yığından bellek ayırmaz
+    struct IterationScratch {
+        std::vector<int> path;
+        std::vector<CriticalBlock> blocks;
+        std::vector<int> criticalPairs;
+        std::vector<int> candidates;
+        std::vector<int> tails;
+        std::vector<std::pair<int, int>> estimates;
+        MoveJournal journal;
+    };
+    mutable IterationScratch scratch_;
+
+    // Her kabul edilen iterasyondan sonra çağrılır; false dönerse arama durur
+    std::function<bool(int iteration, int makespan)> iterationCallback_;
 
     /**
-     * Bir makinede iki bitişik işlemi değiştirir (swap).
+     * Aday hamleleri (sequence indeksleri) değerlendirir ve en iyisini döndürür.
+     * Eşit makespan'da küçük aday indeksi kazanır; sonuç iş parçacığı sayısından bağımsızdır.
      * 
-     * @param schedule Değiştirilecek çizelge
-     * @param machineId Makine ID'si
-     * @param pos1 İlk işlemin pozisyonu
-     * @param pos2 İkinci işlemin pozisyonu (pos1 + 1 olmalı)
-     * @return Değiştirilmiş çizelge (kopya)
+     * @param working Çözülmüş çalışma çizelgesi (dönüşte değişmemiş olur)
+     * @param currentMakespan Mevcut makespan (sadece daha iyileri kabul edilir)
+     * @param candidates Aday swap'ların sequence indeksleri
+     * @param hash working'in makine sırası özeti (sadece önbellek varsa kullanılır)
+     * @return (en iyi makespan, en iyi hamle)
      */
-    Schedule swapAdjacentOperations(
+    std::pair<int, SwapMove> evaluateCandidates(
+        Schedule& working,
+        int currentMakespan,
+        const std::vector<int>& candidates,
+        std::uint64_t hash) const;
+
+    /**
+     * Taillard / Nowicki–Smutnicki tahmini: sequence[seqIndex] ile sequence[seqIndex + 1]
+     * yer değiştirdiğinde bu iki işlemden geçen en uzun yolun uzunluğu.
+     * Swap döngü oluşturmuyorsa yeni makespan bu değerden küçük olamaz.
+     * 
+     * @param schedule Çözülmüş çizelge (startTime = baş değerleri)
+     * @param tails ScheduleDecoder::computeTails çıktısı
+     * @param seqIndex Swap edilecek ilk işlemin sequence indeksi
+     * @return Tahmini makespan alt sınırı
+     */
+    int estimateSwapMakespan(
         const Schedule& schedule,
-        const std::string& machineId,
-        size_t pos1,
-        size_t pos2) const;
+        const std::vector<int>& tails,
+        int seqIndex) const;
 
     /**
-     * Bir çizelgede tüm geçerli swap'ları bulur ve en iyisini döndürür.
+     * Kritik bloklardaki geçerli swap'ları yerinde değerlendirir ve en iyisini döndürür.
+     * Her aday çalışma çizelgesine uygulanır, makespan'ı okunur ve geri alınır;
+     * en iyi aday çizelge kopyası yerine hamle tanımlayıcısı olarak kaydedilir.
      * 
-     * @param currentSchedule Mevcut çizelge
+     * @param working Çözülmüş çalışma çizelgesi (dönüşte değişmemiş olur)
      * @param currentMakespan Mevcut makespan
-     * @return En iyi swap sonucu (makespan, yeni çizelge) veya (currentMakespan, currentSchedule) eğer iyileştirme yoksa
+     * @param hash working'in makine sırası özeti (sadece önbellek varsa kullanılır)
+     * @return (en iyi makespan, en iyi hamle); iyileştirme yoksa hamle geçersizdir
      */
-    std::pair<int, Schedule> findBestSwap(
-        const Schedule& currentSchedule,
-        int currentMakespan) const;
+    std::pair<int, SwapMove> findBestSwap(
+        Schedule& working,
+        int currentMakespan,
+        std::uint64_t hash) const;
 
 public:
     /**
@@ -50,6 +121,59 @@ public:
      */
     explicit LocalSearch(const ProblemInstance& instance);
 
+    /**
+     * Alt sınırı önceden hesaplanmış olarak alır (LowerBounds::best yeniden
+     * çalıştırılmaz); aynı örnekte çok sayıda arama kuran çağıranlar için.
+     *
+     * @param instance Problem örneği
+     * @param lowerBound Örneğin alt sınırı (LowerBounds::best)
+     */
+    LocalSearch(const ProblemInstance& instance, int lowerBound);
+
+    /**
+     * Komşu değerlendirme modunu ayarlar.
+     * 
+     * @param mode Değerlendirme modu
+     * @param verifiedCandidates HeadTailEstimate modunda tam olarak doğrulanan aday sayısı
+     */
+    void setEvaluationMode(EvaluationMode mode, int verifiedCandidates = 3);
+
+    /**
+     * Komşu değerlendirmesi için iş parçacığı sayısını ayarlar.
+     * Adaylar işçilere bölünür; en iyi hamle deterministik olarak seçilir.
+     * Aynı LocalSearch nesnesi aynı anda birden fazla iş parçacığından kullanılmamalıdır.
+     * 
+     * @param threads İş parçacığı sayısı (1: seri, varsayılan; <= 0: tüm çekirdekler)
+     */
+    void setThreadCount(int threads);
+
+    int threadCount() const { return pool_ ? pool_->size() : 1; }
+
+    /**
+     * Aday değerlendirmeleri için önbellek ayarlar (nullptr: kapalı, varsayılan).
+     * Önbellek başka aramalarla ve iş parçacıklarıyla paylaşılabilir; isabet
+     * oranı ve kazanılan çözme sayısı cache->stats() ile okunur. Kabul edilen
+     * hamlenin değeri uygulanırken doğrulanır; sonuç, özet çakışmaları dışında
+     * (bkz. EvaluationCache) önbellekten bağımsızdır.
+     *
+     * @param cache Bu örneğe ait önbellek
+     */
+    void setEvaluationCache(std::shared_ptr<EvaluationCache> cache) { cache_ = std::move(cache); }
+
+    const std::shared_ptr<EvaluationCache>& evaluationCache() const { return cache_; }
+
+    // Örneğin alt sınırı (LowerBounds::best)
+    int lowerBound() const { return lowerBound_; }
+
+    /**
+     * Her iyileştirici iterasyondan sonra çağrılacak fonksiyonu ayarlar.
+     * Portföy gibi dış denetleyiciler aramayı erken kesmek için kullanır.
+     * 
+     * @param callback callback(tamamlanan iterasyon sayısı, güncel makespan);
+     *                 false dönerse improveSchedule o anki çizelgeyle döner
+     */
+    void setIterationCallback(std::function<bool(int iteration, int makespan)> callback);
+
     /**
      * Bir çizelgeyi yerel arama ile iyileştirir.
      * Bitişik işlemleri değiştirerek daha iyi makespan bulmaya çalışır.
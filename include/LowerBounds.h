@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Models.h"
+
+/**
+ * LowerBoundReport: Makespan için alt sınırlar.
+ */
+struct LowerBoundReport {
+    int jobLength = 0;       // En uzun işin toplam süresi
+    int machineLoad = 0;     // En yüklü makinenin toplam süresi
+    int oneMachine = 0;      // Kesintili tek makine (Jackson) gevşetmesi, baş ve kuyruklarla
+    int oneMachineMachine = -1; // oneMachine sınırını veren makine (yoğun indeks)
+
+    int best() const {
+        int b = jobLength > machineLoad ? jobLength : machineLoad;
+        return b > oneMachine ? b : oneMachine;
+    }
+};
+
+/**
+ * LowerBounds: Makespan alt sınırları.
+ *
+ * - İş uzunluğu: bir iş kendi işlemlerini sırayla yapmak zorundadır.
+ * - Makine yükü: bir makine işlemlerini ardışık yapmak zorundadır.
+ * - Tek makine gevşetmesi: her makine için, işlemlerin başları (iş öncüllerinin
+ *   toplam süresi) serbest bırakma zamanı, kuyrukları (iş ardıllarının toplam
+ *   süresi) teslim süresi olarak alınır ve kesintili problem Jackson kuralıyla
+ *   (en büyük kuyruk önce) optimal çözülür. Makine yükü sınırından hiçbir
+ *   zaman zayıf değildir; makine başına O(n log n).
+ *
+ * Bir çizelgenin makespan'ı best()'e eşitse çizelge optimaldir; çözücüler bu
+ * noktada durur.
+ */
+class LowerBounds {
+public:
+    /**
+     * Tüm sınırları hesaplar.
+     *
+     * @param instance Problem örneği
+     * @return Sınırlar
+     */
+    static LowerBoundReport compute(const ProblemInstance& instance);
+
+    /**
+     * En güçlü alt sınır (compute(instance).best()).
+     */
+    static int best(const ProblemInstance& instance) { return compute(instance).best(); }
+
+    /**
+     * Alt sınıra göre yüzde optimallik farkı: 100 * (makespan - lb) / lb.
+     *
+     * @return Fark; makespan veya sınır bilinmiyorsa -1
+     */
+    static double gapPercent(int makespan, int lowerBound) {
+        if (makespan < 0 || lowerBound <= 0) return -1.0;
+        return 100.0 * (makespan - lowerBound) / lowerBound;
+    }
+};
@@ -8,11 +8,20 @@
 class MakespanCalculator {
 public:
     /**
-     * Çözülmüş bir çizelgeden makespan'ı hesaplar.
+     * Çözülmüş bir çizelgenin makespan'ını döndürür.
+     * Makespan çözme sırasında takip edildiği için O(1)'dir.
      * 
-     * @param schedule opTimes'ı doldurulmuş çizelge
-     * @return Makespan (maksimum bitiş zamanı), çizelge boş/geçersizse -1
+     * @param schedule Çözülmüş çizelge
+     * @return Makespan (maksimum bitiş zamanı), çizelge boş/çözülmemişse -1
      */
     static int calculate(const Schedule& schedule);
-};
 
+    /**
+     * Makespan'ı ve onu belirleyen işlemi endTime dizisini tarayarak yeniden hesaplar.
+     * Zamanlar elle değiştirildiğinde kullanılır.
+     * 
+     * @param schedule Zamanları doldurulmuş çizelge (makespan/makespanOp güncellenir)
+     * @return Makespan, hiç çizelgelenmiş işlem yoksa -1
+     */
+    static int recalculate(Schedule& schedule);
+};
@@ -1,54 +1,83 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <deque>
-#include <optional>
 #include <sstream>
 #include <unordered_map>
 #include <memory>
+#include <algorithm>
+#include <stdexcept>
 
 // --------------------
-// Operation key (stable identifier)
+// IdTable: interns string ids as small dense integers (0..size-1, first-seen order)
+// - each distinct string is stored once; records keep only the integer
+// - append-only: an id never changes or goes away once interned
+// - references returned by name() stay valid until the table is destroyed
+// --------------------
+class IdTable {
+private:
+    std::deque<std::string> names_;  // deque: growth does not move stored strings
+    std::unordered_map<std::string, int> index_;
+
+public:
+    // Returns the id of name, adding it if new
+    int intern(const std::string& name) {
+        auto [it, added] = index_.emplace(name, static_cast<int>(names_.size()));
+        if (added) names_.push_back(name);
+        return it->second;
+    }
+
+    // -1 if not interned
+    int find(const std::string& name) const {
+        auto it = index_.find(name);
+        return (it == index_.end()) ? -1 : it->second;
+    }
+
+    const std::string& name(int id) const { return names_.at(id); }
+    int size() const { return static_cast<int>(names_.size()); }
+};
+
+// --------------------
+// Operation key (stable identifier): interned job id (ProblemInstance::ids) plus
+// the op's index within its job. Unlike dense indices it survives recompiles;
+// a key whose job was removed or shortened simply stops resolving (findOp: -1).
+// Strings only at the I/O boundary (NamedOpKey).
 // --------------------
 struct OpKey {
+    std::int32_t job = -1;
+    std::int32_t opIndex = 0;
+};
+static_assert(sizeof(OpKey) == 8, "OpKey must stay a compact 8-byte record");
+
+// String-keyed operation reference for input/output (machine orders, reports)
+struct NamedOpKey {
     std::string jobId;
     int opIndex = 0;
 };
 
 // --------------------
-// Operation
+// Operation: fixed-size integer record. The job is implied by the owning Job;
+// machine is an id interned in the owning ProblemInstance (ProblemInstance::intern).
 // --------------------
 class Operation {
 private:
-    std::string jobId_;
-    int index_ = 0;
-    std::string machineId_;
-    int duration_ = 0;
+    std::int32_t index_ = 0;
+    std::int32_t machine_ = -1;
+    std::int32_t duration_ = 0;
 
 public:
-    Operation(std::string jobId, int index, std::string machineId, int duration)
-        : jobId_(std::move(jobId)),
-          index_(index),
-          machineId_(std::move(machineId)),
-          duration_(duration) {}
+    Operation(int index, int machine, int duration)
+        : index_(index), machine_(machine), duration_(duration) {}
 
-    const std::string& jobId() const { return jobId_; }
     int index() const { return index_; }
-    const std::string& machineId() const { return machineId_; }
+    int machine() const { return machine_; }    // ProblemInstance::ids id
     int duration() const { return duration_; }
 
-    // Precedence is job order: (jobId, index-1)
-    std::optional<OpKey> predecessor() const {
-        if (index_ == 0) return std::nullopt;
-        return OpKey{jobId_, index_ - 1};
-    }
-
     std::string toString() const {
         std::ostringstream os;
-        os << "Op(" << jobId_ << "#" << index_
-           << ", M=" << machineId_
-           << ", dur=" << duration_ << ")";
+        os << "Op(#" << index_ << ", M=" << machine_ << ", dur=" << duration_ << ")";
         return os.str();
     }
 };
@@ -110,9 +139,95 @@ public:
 };
 
 // --------------------
-// Schedule representation
-// - machineOrder: solution representation (per-machine sequence)
-// - opTimes: decode result (start/end times), can be filled later
+// CompiledInstance: dense, integer-indexed view of a ProblemInstance
+// - job/machine ids are mapped to 0..n-1 once (sorted by id, deterministic)
+// - string lookups go through the instance's IdTable, then interned -> dense arrays
+// - operations live in flat arrays indexed by dense op id
+// - ops of job j are [jobOffset[j], jobOffset[j+1]) in job order
+// --------------------
+struct CompiledInstance {
+    std::vector<std::string> jobIds;      // dense job index -> id
+    std::vector<std::string> machineIds;  // dense machine index -> id
+
+    // Shared with the owning ProblemInstance; set by bindIds()
+    std::shared_ptr<const IdTable> ids;
+    std::vector<int> jobInterned;   // dense job index -> interned id (OpKey::job)
+    std::vector<int> jobOfId;       // interned id -> dense job index (-1: not a job here)
+    std::vector<int> machineOfId;   // interned id -> dense machine index (-1: not a machine here)
+
+    std::vector<int> jobOffset;   // size numJobs()+1
+    std::vector<int> opJob;       // op -> dense job index
+    std::vector<int> opMachine;   // op -> dense machine index
+    std::vector<int> opDuration;  // op -> duration
+
+    std::vector<int> jobTotalTime;     // job -> sum of durations
+    std::vector<int> remainingWork;    // op -> sum of durations from op to end of its job
+    std::vector<int> machineOpCount;   // machine -> number of ops assigned to it
+
+    int numJobs() const { return static_cast<int>(jobIds.size()); }
+    int numMachines() const { return static_cast<int>(machineIds.size()); }
+    int numOps() const { return static_cast<int>(opJob.size()); }
+
+    int opId(int job, int opIndex) const { return jobOffset[job] + opIndex; }
+    int opIndexOf(int op) const { return op - jobOffset[opJob[op]]; }
+    int jobLength(int job) const { return jobOffset[job + 1] - jobOffset[job]; }
+
+    // Fills the interned <-> dense arrays from jobIds/machineIds. Every id must
+    // already be interned in table (ids interned later simply resolve to -1).
+    void bindIds(std::shared_ptr<const IdTable> table) {
+        ids = std::move(table);
+        jobOfId.assign(ids->size(), -1);
+        machineOfId.assign(ids->size(), -1);
+        jobInterned.resize(jobIds.size());
+        for (int j = 0; j < numJobs(); ++j) {
+            jobInterned[j] = ids->find(jobIds[j]);
+            jobOfId.at(jobInterned[j]) = j;
+        }
+        for (int m = 0; m < numMachines(); ++m) {
+            machineOfId.at(ids->find(machineIds[m])) = m;
+        }
+    }
+
+    // -1 if not found
+    int findJob(const std::string& id) const { return jobOfInterned(ids ? ids->find(id) : -1); }
+
+    int findMachine(const std::string& id) const {
+        int interned = ids ? ids->find(id) : -1;
+        return (interned < 0 || interned >= static_cast<int>(machineOfId.size())) ? -1 : machineOfId[interned];
+    }
+
+    // interned id -> dense job index, -1 if not a job of this view
+    int jobOfInterned(int interned) const {
+        return (interned < 0 || interned >= static_cast<int>(jobOfId.size())) ? -1 : jobOfId[interned];
+    }
+
+    // -1 if job unknown or opIndex out of range
+    int findOp(const std::string& jobId, int opIndex) const {
+        return denseOp(findJob(jobId), opIndex);
+    }
+
+    int findOp(const OpKey& key) const { return denseOp(jobOfInterned(key.job), key.opIndex); }
+
+    OpKey keyOf(int op) const { return OpKey{jobInterned[opJob[op]], opIndexOf(op)}; }
+
+    // String ids (I/O boundary)
+    NamedOpKey nameOf(int op) const { return NamedOpKey{jobIds[opJob[op]], opIndexOf(op)}; }
+
+private:
+    int denseOp(int job, int opIndex) const {
+        if (job < 0 || opIndex < 0 || opIndex >= jobLength(job)) return -1;
+        return opId(job, opIndex);
+    }
+};
+
+// --------------------
+// Schedule representation (structure-of-arrays, indexed by dense op id)
+// - sequence/machineOffset: solution representation; machine m's order is
+//   sequence[machineOffset[m] .. machineOffset[m+1])
+// - position: op -> index into sequence (-1 if the op is not sequenced)
+// - startTime/endTime: decode result (-1 until decoded), filled by ScheduleDecoder
+// - makespan/makespanOp: tracked while decoding
+// Copying a Schedule copies a handful of int vectors, no strings or maps.
 // --------------------
 struct TimeWindow {
     int start = 0;
@@ -121,25 +236,164 @@ struct TimeWindow {
 
 class Schedule {
 public:
-    // machineId -> sequence of operations in that machine
-    std::unordered_map<std::string, std::vector<OpKey>> machineOrder;
+    // Layout the dense indices refer to (owned by the ProblemInstance)
+    const CompiledInstance* layout = nullptr;
+
+    std::vector<int> sequence;
+    std::vector<int> machineOffset;
+    std::vector<int> position;
+
+    std::vector<int> startTime;
+    std::vector<int> endTime;
+
+    int makespan = -1;
+    int makespanOp = -1;
+
+    Schedule() = default;
 
-    // opTimes[jobId][opIndex] = (start,end)
-    std::unordered_map<std::string, std::unordered_map<int, TimeWindow>> opTimes;
+    // Empty machine orders for every machine of the instance
+    explicit Schedule(const CompiledInstance& ci)
+        : layout(&ci),
+          machineOffset(ci.numMachines() + 1, 0),
+          position(ci.numOps(), -1),
+          startTime(ci.numOps(), -1),
+          endTime(ci.numOps(), -1) {}
+
+    // Builds from dense per-machine sequences (sequences[m] = op ids on machine m)
+    static Schedule fromSequences(const CompiledInstance& ci,
+                                  const std::vector<std::vector<int>>& sequences) {
+        Schedule s(ci);
+        for (int m = 0; m < ci.numMachines(); ++m) {
+            if (m < static_cast<int>(sequences.size())) {
+                for (int op : sequences[m]) {
+                    s.position[op] = static_cast<int>(s.sequence.size());
+                    s.sequence.push_back(op);
+                }
+            }
+            s.machineOffset[m + 1] = static_cast<int>(s.sequence.size());
+        }
+        return s;
+    }
+
+    // Builds from string-keyed machine orders (I/O boundary).
+    // Throws std::runtime_error on unknown machine/job ids or op indices.
+    static Schedule fromMachineOrder(
+        const CompiledInstance& ci,
+        const std::unordered_map<std::string, std::vector<NamedOpKey>>& machineOrder) {
+        std::vector<std::vector<int>> sequences(ci.numMachines());
+        for (const auto& [mid, seq] : machineOrder) {
+            int m = ci.findMachine(mid);
+            if (m < 0) throw std::runtime_error("Schedule: unknown machine " + mid);
+            for (const NamedOpKey& key : seq) {
+                int op = ci.findOp(key.jobId, key.opIndex);
+                if (op < 0) {
+                    throw std::runtime_error("Schedule: unknown operation " + key.jobId +
+                                             "#" + std::to_string(key.opIndex));
+                }
+                sequences[m].push_back(op);
+            }
+        }
+        return fromSequences(ci, sequences);
+    }
+
+    int numMachines() const { return static_cast<int>(machineOffset.size()) - 1; }
+    int machineBegin(int m) const { return machineOffset[m]; }
+    int machineEnd(int m) const { return machineOffset[m + 1]; }
+    int machineSize(int m) const { return machineOffset[m + 1] - machineOffset[m]; }
+
+    bool isScheduled(int op) const { return endTime[op] >= 0; }
+    TimeWindow timeWindow(int op) const { return TimeWindow{startTime[op], endTime[op]}; }
+
+    void setTimeWindow(int op, TimeWindow tw) {
+        startTime[op] = tw.start;
+        endTime[op] = tw.end;
+    }
+
+    // Key accessors; NamedOpKey for callers working with string ids
+    TimeWindow timeOf(const OpKey& key) const { return timeWindow(opOf(key)); }
+    TimeWindow timeOf(const NamedOpKey& key) const { return timeWindow(opOf(key)); }
+    void setTimeOf(const OpKey& key, TimeWindow tw) { setTimeWindow(opOf(key), tw); }
+    void setTimeOf(const NamedOpKey& key, TimeWindow tw) { setTimeWindow(opOf(key), tw); }
+
+    // Swaps the ops at two sequence indices (keeps position in sync)
+    void swapPositions(int a, int b) {
+        std::swap(sequence[a], sequence[b]);
+        position[sequence[a]] = a;
+        position[sequence[b]] = b;
+    }
+
+    // Moves the op at sequence index 'from' to index 'to', shifting the ops
+    // in between by one (both indices on the same machine)
+    void moveOperation(int from, int to) {
+        if (from < to) {
+            std::rotate(sequence.begin() + from, sequence.begin() + from + 1,
+                        sequence.begin() + to + 1);
+        } else if (to < from) {
+            std::rotate(sequence.begin() + to, sequence.begin() + from,
+                        sequence.begin() + from + 1);
+        }
+        for (int i = std::min(from, to); i <= std::max(from, to); ++i) {
+            position[sequence[i]] = i;
+        }
+    }
+
+    // Drops decode results (times/makespan); machine orders are kept
+    void clearTimes() {
+        std::fill(startTime.begin(), startTime.end(), -1);
+        std::fill(endTime.begin(), endTime.end(), -1);
+        makespan = -1;
+        makespanOp = -1;
+    }
+
+    // String-keyed machine orders (I/O boundary)
+    std::unordered_map<std::string, std::vector<NamedOpKey>> machineOrder() const {
+        std::unordered_map<std::string, std::vector<NamedOpKey>> out;
+        for (int m = 0; m < numMachines(); ++m) {
+            std::vector<NamedOpKey>& seq = out[layout->machineIds[m]];
+            for (int p = machineBegin(m); p < machineEnd(m); ++p) {
+                seq.push_back(layout->nameOf(sequence[p]));
+            }
+        }
+        return out;
+    }
 
     std::string toString() const {
         std::ostringstream os;
         os << "Schedule:\n";
-        for (const auto& [mid, seq] : machineOrder) {
-            os << "  " << mid << ": ";
-            for (size_t i = 0; i < seq.size(); ++i) {
-                if (i) os << " -> ";
-                os << seq[i].jobId << "#" << seq[i].opIndex;
+        for (int m = 0; m < numMachines(); ++m) {
+            os << "  " << (layout ? layout->machineIds[m] : std::to_string(m)) << ": ";
+            for (int p = machineBegin(m); p < machineEnd(m); ++p) {
+                if (p > machineBegin(m)) os << " -> ";
+                if (layout) {
+                    NamedOpKey key = layout->nameOf(sequence[p]);
+                    os << key.jobId << "#" << key.opIndex;
+                } else {
+                    os << sequence[p];
+                }
             }
             os << "\n";
         }
         return os.str();
     }
+
+private:
+    int opOf(const OpKey& key) const {
+        int op = layout ? layout->findOp(key) : -1;
+        if (op < 0) {
+            throw std::runtime_error("Schedule: unknown operation " + std::to_string(key.job) +
+                                     "#" + std::to_string(key.opIndex));
+        }
+        return op;
+    }
+
+    int opOf(const NamedOpKey& key) const {
+        int op = layout ? layout->findOp(key.jobId, key.opIndex) : -1;
+        if (op < 0) {
+            throw std::runtime_error("Schedule: unknown operation " + key.jobId +
+                                     "#" + std::to_string(key.opIndex));
+        }
+        return op;
+    }
 };
 
 // --------------------
@@ -150,6 +404,40 @@ struct ProblemInstance {
     std::unordered_map<std::string, std::unique_ptr<Machine>> machines;
     std::unordered_map<std::string, std::unique_ptr<Job>> jobs;
 
+    // Single id table for machine and job ids: Operation::machine and OpKey::job
+    // are ids in it. Shared (read-only) with the compiled view; only ever grows,
+    // so ids and OpKeys stay valid across compile(). Jobs built for one instance
+    // must not be moved into another.
+    std::shared_ptr<IdTable> ids = std::make_shared<IdTable>();
+
+    int intern(const std::string& id) { return ids->intern(id); }
+    const std::string& machineName(const Operation& op) const { return ids->name(op.machine()); }
+
+    // Builds the dense view from machines/jobs. Call again after editing them.
+    // Throws std::runtime_error if an op references an unknown machine.
+    //
+    // The previous view is retired, not destroyed: Schedules built on it keep a
+    // valid layout and describe the old instance (carry them over with
+    // Schedule::fromMachineOrder(compiled(), s.machineOrder())). Everything else
+    // that sized itself from the old view (LocalSearch, BatchEvaluator, decode
+    // workspaces, caches, ...) must be recreated after recompiling. Retired
+    // views are freed with the instance.
+    void compile() { install(buildCompiled()); }
+
+    // Installs a prebuilt dense view (e.g. loaded from a snapshot) instead of
+    // rebuilding it. It must describe exactly these machines/jobs and be bound
+    // to this instance's ids. Retires the current view like compile().
+    void adoptCompiled(std::unique_ptr<CompiledInstance> compiled) {
+        install(std::move(compiled));
+    }
+
+    // Dense view used by all solver components. Built lazily on first use if
+    // compile() was not called (not thread-safe; compile before sharing).
+    const CompiledInstance& compiled() const {
+        if (!compiled_) compiled_ = buildCompiled();
+        return *compiled_;
+    }
+
     // Safe getters (return nullptr if not found)
     const Machine* getMachine(const std::string& id) const {
         auto it = machines.find(id);
@@ -169,4 +457,67 @@ struct ProblemInstance {
         for (const auto& [id, j] : jobs) os << "  " << j->toString() << "\n";
         return os.str();
     }
+
+private:
+    // heap-allocated so its address survives moves of the instance
+    mutable std::unique_ptr<CompiledInstance> compiled_;
+    // earlier views, kept so Schedule::layout pointers into them stay valid
+    std::vector<std::unique_ptr<CompiledInstance>> retired_;
+
+    void install(std::unique_ptr<CompiledInstance> compiled) {
+        if (compiled_) retired_.push_back(std::move(compiled_));
+        compiled_ = std::move(compiled);
+    }
+
+    std::unique_ptr<CompiledInstance> buildCompiled() const {
+        auto c = std::make_unique<CompiledInstance>();
+
+        c->machineIds.reserve(machines.size());
+        for (const auto& [id, _] : machines) c->machineIds.push_back(id);
+        std::sort(c->machineIds.begin(), c->machineIds.end());
+        c->machineOpCount.assign(c->machineIds.size(), 0);
+
+        c->jobIds.reserve(jobs.size());
+        for (const auto& [id, _] : jobs) c->jobIds.push_back(id);
+        std::sort(c->jobIds.begin(), c->jobIds.end());
+
+        // interning only appends, so ids already handed out stay valid
+        for (const std::string& id : c->machineIds) ids->intern(id);
+        for (const std::string& id : c->jobIds) ids->intern(id);
+        c->bindIds(ids);
+
+        c->jobOffset.reserve(c->jobIds.size() + 1);
+        c->jobOffset.push_back(0);
+        c->jobTotalTime.reserve(c->jobIds.size());
+        for (size_t j = 0; j < c->jobIds.size(); ++j) {
+            int total = 0;
+            for (const auto& op : jobs.at(c->jobIds[j])->operations()) {
+                bool interned = op.machine() >= 0 && op.machine() < ids->size();
+                int m = interned ? c->machineOfId[op.machine()] : -1;
+                if (m < 0) {
+                    std::string name = interned ? ids->name(op.machine())
+                                                : "#" + std::to_string(op.machine());
+                    throw std::runtime_error("compile: unknown machine " + name +
+                                             " in job " + c->jobIds[j]);
+                }
+                c->opJob.push_back(static_cast<int>(j));
+                c->opMachine.push_back(m);
+                c->opDuration.push_back(op.duration());
+                c->machineOpCount[m]++;
+                total += op.duration();
+            }
+            c->jobTotalTime.push_back(total);
+            c->jobOffset.push_back(static_cast<int>(c->opJob.size()));
+
+            // suffix sums over this job's ops
+            c->remainingWork.resize(c->opJob.size());
+            int rest = 0;
+            for (int op = c->jobOffset[j + 1] - 1; op >= c->jobOffset[j]; --op) {
+                rest += c->opDuration[op];
+                c->remainingWork[op] = rest;
+            }
+        }
+
+        return c;
+    }
 };
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "Models.h"
+#include "ScheduleDecoder.h"
+#include "ScheduleHash.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * MoveJournal: Bir hamlenin geri alınması için gereken kayıt.
+ * Aynı günlük adaylar arasında tekrar kullanılırsa ek bellek ayırmaz.
+ */
+struct MoveJournal {
+    std::vector<TimeChange> changes;
+    int makespan = -1;
+    int makespanOp = -1;
+
+    void clear() {
+        changes.clear();
+        makespan = -1;
+        makespanOp = -1;
+    }
+};
+
+/**
+ * SwapMove: Bir makinede bitişik iki işlemin yer değiştirmesi.
+ *
+ * Hamle, çizelge kopyası yerine tanımlayıcısı (sequence indeksi) ile temsil edilir;
+ * apply/undo tek bir çalışma çizelgesi üzerinde yerinde çalışır ve zamanlar
+ * artımlı olarak güncellenir.
+ */
+class SwapMove {
+public:
+    int seqIndex = -1; // sequence[seqIndex] <-> sequence[seqIndex + 1]
+
+    SwapMove() = default;
+    explicit SwapMove(int index) : seqIndex(index) {}
+
+    bool isValid() const { return seqIndex >= 0; }
+
+    // Hamle uygulandıktan sonraki makine sırası özeti (çizelge değişmez)
+    std::uint64_t hashAfter(const Schedule& schedule, std::uint64_t hash) const {
+        return ScheduleHash::afterSwap(hash, schedule, seqIndex);
+    }
+
+    /**
+     * Hamleyi uygular ve zamanları artımlı günceller.
+     * 
+     * @param schedule Çözülmüş çalışma çizelgesi
+     * @param instance Problem örneği
+     * @param journal Geri alma kaydı (temizlenip doldurulur)
+     * @return Uygulandıysa true; döngü oluşturursa false (çizelge değişmez)
+     */
+    bool apply(Schedule& schedule, const ProblemInstance& instance, MoveJournal& journal) const;
+
+    /**
+     * apply ile yapılan değişikliği geri alır.
+     * 
+     * @param schedule apply'ın uygulandığı çizelge
+     * @param journal apply'ın doldurduğu kayıt
+     */
+    void undo(Schedule& schedule, const MoveJournal& journal) const;
+};
+
+/**
+ * InsertMove: Bir makinede sequence[from] işleminin sequence[to] konumuna taşınması
+ * (aradaki işlemler bir kaydırılır). |from - to| == 1 ise bitişik swap'tır.
+ *
+ * Kritik blok komşulukları (N5/N6) bu hamleyle ifade edilir.
+ */
+class InsertMove {
+public:
+    int from = -1;
+    int to = -1;
+
+    InsertMove() = default;
+    InsertMove(int fromIndex, int toIndex) : from(fromIndex), to(toIndex) {}
+
+    bool isValid() const { return from >= 0 && to >= 0; }
+
+    // Hamle uygulandıktan sonraki makine sırası özeti (çizelge değişmez)
+    std::uint64_t hashAfter(const Schedule& schedule, std::uint64_t hash) const {
+        return ScheduleHash::afterInsert(hash, schedule, from, to);
+    }
+
+    /**
+     * Hamleyi uygular ve zamanları artımlı günceller.
+     * 
+     * @param schedule Çözülmüş çalışma çizelgesi
+     * @param instance Problem örneği
+     * @param journal Geri alma kaydı (temizlenip doldurulur)
+     * @return Uygulandıysa true; döngü oluşturursa false (çizelge değişmez)
+     */
+    bool apply(Schedule& schedule, const ProblemInstance& instance, MoveJournal& journal) const;
+
+    /**
+     * apply ile yapılan değişikliği geri alır.
+     * 
+     * @param schedule apply'ın uygulandığı çizelge
+     * @param journal apply'ın doldurduğu kayıt
+     */
+    void undo(Schedule& schedule, const MoveJournal& journal) const;
+};
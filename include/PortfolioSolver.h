@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Models.h"
+#include "Heuristics.h"
+#include "LocalSearch.h"
+#include "LowerBounds.h"
+#include <string>
+#include <vector>
+
+/**
+ * PortfolioOptions: Portföy çözücü ayarları.
+ */
+struct PortfolioOptions {
+    int threads = 0;                 // <= 0: tüm çekirdekler
+    int maxIterations = 100;         // Strateji başına LocalSearch iterasyon sınırı
+    double cutoffRatio = 0.10;       // Güncel > en_iyi * (1 + oran) ise strateji kesilir
+    int cutoffGraceIterations = 10;  // Kesme kontrolünden önce en az bu kadar iterasyon
+    std::vector<DispatchHeuristics::Rule> rules; // Boş: tüm hazır kurallar
+};
+
+/**
+ * StrategyResult: Bir stratejinin (dağıtım kuralı + yerel arama) sonucu.
+ */
+struct StrategyResult {
+    std::string name;
+    int initialMakespan = -1;   // Dağıtım kuralının makespan'ı
+    int makespan = -1;          // Yerel arama sonrası makespan
+    double wallSeconds = 0.0;
+    int iterations = 0;
+    bool cutOff = false;        // Kaybeden olarak erken kesildi mi
+};
+
+/**
+ * PortfolioResult: En iyi çizelge ve strateji başına sonuç tablosu.
+ */
+struct PortfolioResult {
+    Schedule best;
+    int bestMakespan = -1;
+    std::string bestStrategy;
+    std::vector<StrategyResult> strategies; // Kural sırasında
+    int lowerBound = -1;                    // LowerBounds::best
+
+    double gapPercent() const { return LowerBounds::gapPercent(bestMakespan, lowerBound); }
+};
+
+/**
+ * PortfolioSolver: Tüm dağıtım sezgilerini, her biri ardından
+ * LocalSearch::improveSchedule ile, ayrı iş parçacıklarında çalıştırır.
+ *
+ * Stratejiler ortak bir "şimdiye kadarki en iyi" makespan paylaşır; belirli
+ * bir iterasyondan sonra bu değerin çok gerisinde kalan yerel aramalar
+ * kesilir, böylece çekirdekler kaybedenlerle meşgul olmaz. Ortak en iyi alt
+ * sınıra ulaşınca (optimal) tüm stratejiler durur.
+ */
+class PortfolioSolver {
+private:
+    const ProblemInstance& instance_;
+
+public:
+    /**
+     * @param instance Problem örneği
+     */
+    explicit PortfolioSolver(const ProblemInstance& instance);
+
+    /**
+     * Portföyü çalıştırır.
+     * 
+     * @param options Ayarlar
+     * @return En iyi çizelge ve strateji tablosu
+     */
+    PortfolioResult solve(const PortfolioOptions& options = PortfolioOptions()) const;
+};
@@ -1,6 +1,53 @@
 #pragma once
 
 #include "Models.h"
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+/**
+ * Artımlı çözme sırasında üzerine yazılan zaman kaydı (geri alma için).
+ */
+struct TimeChange {
+    int op = -1;
+    int start = 0;
+    int end = 0;
+};
+
+/**
+ * DecoderWorkspace: Çözme işlemlerinin tekrar kullanılan geçici alanı.
+ *
+ * Vektörler ilk kullanımda örnek boyutuna büyür, sonra kapasiteleri korunur;
+ * böylece kararlı durumda çözme, artımlı güncelleme ve kuyruk hesabı yığından
+ * bellek ayırmaz. Bir çalışma alanı aynı anda tek iş parçacığı tarafından
+ * kullanılmalıdır.
+ */
+struct DecoderWorkspace {
+    // Tam çözme / kuyruklar
+    std::vector<int> degree;      // Giriş (çözme) veya çıkış (kuyruk) derecesi
+    std::vector<int> ready;
+
+    // Artımlı çözme: damgalı ziyaret işaretleri, DFS yığını ve yayılım kuyruğu
+    std::vector<int> visitStamp;
+    std::vector<int> queuedStamp;
+    int stamp = 0;
+    std::vector<int> stack;
+    std::vector<std::pair<int, int>> heap; // (anahtar, işlem), min-heap
+
+    // Damgaları yeni bir geçiş için hazırlar (boyut değişmedikçe O(1))
+    void prepare(int numOps) {
+        if (static_cast<int>(visitStamp.size()) != numOps) {
+            visitStamp.assign(numOps, 0);
+            queuedStamp.assign(numOps, 0);
+            stamp = 0;
+        }
+        if (++stamp == 0) {
+            std::fill(visitStamp.begin(), visitStamp.end(), 0);
+            std::fill(queuedStamp.begin(), queuedStamp.end(), 0);
+            stamp = 1;
+        }
+    }
+};
 
 /**
  * ScheduleDecoder: Makine başına işlem sıralarını zamana dayalı bir çizelgeye dönüştürür.
@@ -10,16 +57,109 @@
  * - Bir makine aynı anda sadece 1 işlem çalıştırabilir
  * - başlangıç = max(iş_hazır_zamanı, makine_müsait_zamanı)
  * - bitiş = başlangıç + süre
+ *
+ * Çözme, ayrık (disjunctive) grafik üzerinde tek bir topolojik geçiştir:
+ * her işlemin en fazla iki öncülü (iş öncülü, makine öncülü) vardır ve
+ * giriş derecesi sayaçları ile O(işlem) zamanda işlenir.
+ *
+ * Çalışma alanı almayan fonksiyonlar iş parçacığı başına bir DecoderWorkspace
+ * (threadWorkspace) kullanır; kararlı durumda hiçbiri bellek ayırmaz.
  */
 class ScheduleDecoder {
 public:
     /**
-     * machineOrder'a göre opTimes'ı doldurarak bir çizelgeyi çözer.
+     * Çözme sonucu.
+     */
+    enum class Status {
+        Ok,
+        InvalidOperation,     // Çizelge bu örneğin düzenine göre kurulmamış
+        WrongMachine,         // İşlem kendi makinesinden farklı bir sırada
+        DuplicateOperation,   // İşlem birden fazla kez sıralanmış
+        MissingPredecessor,   // İşin önceki işlemi hiçbir sırada yok
+        Cycle                 // Makine sıraları iş sırasıyla çelişiyor (döngü)
+    };
+
+    /**
+     * Makine sıralarına göre startTime/endTime ve makespan'ı doldurarak bir çizelgeyi çözer.
      * 
-     * @param schedule machineOrder'ı doldurulmuş çizelge (opTimes doldurulacak)
+     * @param schedule Makine sıraları doldurulmuş çizelge (zamanlar doldurulacak)
      * @param instance İş ve makine tanımlarını içeren problem örneği
      * @return çözme başarılıysa true, aksi halde false
      */
     static bool decode(Schedule& schedule, const ProblemInstance& instance);
-};
 
+    /**
+     * decode ile aynıdır, ancak başarısızlığın nedenini döndürür.
+     * 
+     * @param schedule Makine sıraları doldurulmuş çizelge (zamanlar doldurulacak)
+     * @param instance Problem örneği
+     * @return Status::Ok veya hata nedeni (Cycle: uygulanamaz makine sıraları)
+     */
+    static Status decodeWithStatus(Schedule& schedule, const ProblemInstance& instance);
+
+    /**
+     * decodeWithStatus ile aynıdır, verilen çalışma alanını kullanır.
+     */
+    static Status decodeWithStatus(Schedule& schedule, const ProblemInstance& instance,
+                                   DecoderWorkspace& workspace);
+
+    /**
+     * Bir makinede bitişik iki işlemi (sequence[seqIndex] ve sequence[seqIndex + 1])
+     * yer değiştirir ve zamanları artımlı olarak günceller.
+     *
+     * Sadece swap edilen çiftin grafikte aşağısında kalan işlemler yeniden
+     * hesaplanır; bir işlemin zamanı değişmezse onun ardıllarına ilerlenmez.
+     * Döngü kontrolü eski zamanlarla budanmış bir DFS ile yapılır.
+     * 
+     * @param schedule Çözülmüş çizelge (swap yapılır, zamanlar ve makespan güncellenir)
+     * @param instance Problem örneği
+     * @param seqIndex Swap edilecek ilk işlemin sequence indeksi (ikisi aynı makinede olmalı)
+     * @param trail İsteğe bağlı: değiştirilen her zamanın eski değeri sırayla eklenir
+     * @return Status::Ok; swap döngü oluşturursa Status::Cycle (çizelge değişmez)
+     */
+    static Status redecodeAdjacentSwap(Schedule& schedule, const ProblemInstance& instance,
+                                       int seqIndex, std::vector<TimeChange>* trail = nullptr);
+
+    /**
+     * Bir makinede sequence[fromIndex] işlemini toIndex konumuna taşır (aradaki
+     * işlemler bir kaydırılır) ve zamanları artımlı olarak günceller.
+     *
+     * Döngü kontrolü, taşınan işlem ile atladığı blok arasında eski zamanlarla
+     * budanmış bir DFS'dir; redecodeAdjacentSwap ile aynı yayılım kullanılır.
+     *
+     * @param schedule Çözülmüş çizelge (taşıma yapılır, zamanlar ve makespan güncellenir)
+     * @param instance Problem örneği
+     * @param fromIndex Taşınacak işlemin sequence indeksi
+     * @param toIndex Hedef sequence indeksi (aynı makinede olmalı)
+     * @param trail İsteğe bağlı: değiştirilen her zamanın eski değeri sırayla eklenir
+     * @return Status::Ok; taşıma döngü oluşturursa Status::Cycle (çizelge değişmez)
+     */
+    static Status redecodeInsertion(Schedule& schedule, const ProblemInstance& instance,
+                                    int fromIndex, int toIndex,
+                                    std::vector<TimeChange>* trail = nullptr);
+
+    /**
+     * Çözülmüş bir çizelge için kuyrukları (tails) hesaplar: bir işlemin bitişinden
+     * sona kadar olan en uzun yol (işlemin kendi süresi hariç). Ters topolojik
+     * geçiş, O(işlem). startTime baş (head) değerleridir; head + süre + tail,
+     * işlemden geçen en uzun yolun uzunluğudur.
+     * 
+     * @param schedule Çözülmüş çizelge
+     * @param instance Problem örneği
+     * @param tails Çıktı: işlem başına kuyruk (sıralanmamış işlemler için 0)
+     */
+    static void computeTails(const Schedule& schedule, const ProblemInstance& instance,
+                             std::vector<int>& tails);
+
+    /**
+     * computeTails ile aynıdır, verilen çalışma alanını kullanır.
+     */
+    static void computeTails(const Schedule& schedule, const ProblemInstance& instance,
+                             std::vector<int>& tails, DecoderWorkspace& workspace);
+
+    /**
+     * Çağıran iş parçacığının çalışma alanı (çalışma alanı almayan fonksiyonlar
+     * ve artımlı güncellemeler bunu kullanır).
+     */
+    static DecoderWorkspace& threadWorkspace();
+};
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Models.h"
+#include <cstdint>
+
+/**
+ * ScheduleHash: Makine sıralarının (Schedule::sequence) Zobrist tarzı özeti.
+ *
+ * Özet, her makinedeki ardışık işlem çiftlerinin (başlangıç ve bitiş işaretleri
+ * dahil) rastgele anahtarlarının XOR'udur. Çift kümesi makine sıralarını tek
+ * başına belirler, böylece eşit sıralar eşit özet verir; zamanlar özete
+ * girmez. Anahtarlar tablo yerine (önceki, sonraki) çiftinin karıştırılmasıyla
+ * üretilir, bu yüzden bellek kullanımı örnek boyutundan bağımsızdır.
+ *
+ * Bir swap veya ekleme hamlesi en fazla üç çifti değiştirir; yeni özet hamle
+ * uygulanmadan O(1)'de hesaplanır. Farklı sıraların çakışma olasılığı
+ * karşılaştırma başına yaklaşık 2^-64'tür.
+ */
+class ScheduleHash {
+public:
+    /**
+     * Özeti baştan hesaplar: O(numOps).
+     *
+     * @param schedule Çizelge (zamanlar gerekmez)
+     * @return Özet
+     */
+    static std::uint64_t compute(const Schedule& schedule);
+
+    /**
+     * sequence[from] işlemi sequence[to] konumuna taşındıktan sonraki özet
+     * (InsertMove; |from - to| == 1 ise bitişik swap). Çizelge değişmez.
+     *
+     * @param hash Çizelgenin güncel özeti
+     * @param schedule Çizelge (hamle uygulanmadan önceki hali)
+     * @param from Taşınan işlemin sequence indeksi
+     * @param to Hedef sequence indeksi (aynı makinede)
+     * @return Hamle sonrası özet
+     */
+    static std::uint64_t afterInsert(std::uint64_t hash, const Schedule& schedule, int from, int to);
+
+    /**
+     * sequence[seqIndex] ile sequence[seqIndex + 1] yer değiştirdikten sonraki özet.
+     */
+    static std::uint64_t afterSwap(std::uint64_t hash, const Schedule& schedule, int seqIndex) {
+        return afterInsert(hash, schedule, seqIndex, seqIndex + 1);
+    }
+};
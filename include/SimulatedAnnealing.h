@@ -0,0 +1,110 @@
+#pragma once
+
+#include "Models.h"
+#include "ScheduleDecoder.h"
+#include "MakespanCalculator.h"
+#include "Move.h"
+#include "CriticalPathAnalyzer.h"
+#include "Cancellation.h"
+#include "LowerBounds.h"
+#include "EvaluationCache.h"
+#include <functional>
+#include <memory>
+#include <vector>
+
+/**
+ * Sıcaklık azaltma planı.
+ */
+enum class CoolingSchedule {
+    Geometric,   // Her stepsPerTemperature iterasyonda T *= coolingRate
+    LundyMees,   // Her iterasyonda T = T / (1 + lundyMeesBeta * T)
+    TimeBased    // T, süre bütçesi boyunca initial'dan final'a üstel azalır
+};
+
+/**
+ * AnnealingOptions: Benzetimli tavlama ayarları.
+ */
+struct AnnealingOptions {
+    double timeLimitSeconds = 2.0;     // Kesin süre bütçesi (<= 0: yok)
+    long long maxIterations = 0;       // <= 0: yok (ikisi de yoksa 100000 iterasyon)
+    CoolingSchedule cooling = CoolingSchedule::Geometric;
+    double initialTemperature = 0.0;   // <= 0: rastgele hamlelerden otomatik (%50 kabul)
+    double finalTemperature = 0.5;     // TimeBased planın bitiş sıcaklığı ve alt sınır
+    double coolingRate = 0.995;        // Geometric
+    int stepsPerTemperature = 100;     // Geometric
+    double lundyMeesBeta = 1e-4;       // LundyMees
+    double insertProbability = 0.5;    // Aksi halde bitişik swap
+    long long reheatAfter = 5000;      // En iyi iyileşmeden bu kadar iterasyon sonra ısıt (<= 0: yok)
+    double reheatRatio = 0.5;          // Isıtmada T = başlangıç sıcaklığı * oran; en iyi çözüme dönülür
+                                       // (TimeBased planda sıcaklık süre eğrisinde kalır)
+    int targetMakespan = -1;           // Bu değere ulaşılınca dur (< 0: yok)
+    unsigned seed = 1;
+    CancellationToken cancel;          // İptal edilince en iyi çözümle dön
+    // Her yeni en iyi çözümde çağrılır (çizelge sadece çağrı süresince geçerlidir)
+    std::function<void(const Schedule& schedule, int makespan)> onImprovement;
+    // Komşu makespan önbelleği (nullptr: kapalı); reddedilecek tekrar komşular hiç
+    // uygulanmaz, kabul edilen doğrulanır. Sonuç sadece özet çakışmasında değişebilir
+    // (bkz. EvaluationCache)
+    std::shared_ptr<EvaluationCache> cache;
+};
+
+/**
+ * AnnealingResult: Tavlamanın sonucu.
+ */
+struct AnnealingResult {
+    Schedule best;
+    int bestMakespan = -1;
+    int initialMakespan = -1;
+    long long iterations = 0;
+    long long accepted = 0;        // Kabul edilen hamle sayısı
+    int reheats = 0;
+    double initialTemperature = 0.0;
+    double wallSeconds = 0.0;
+    bool timedOut = false;         // Süre bütçesi doldu
+    bool cancelled = false;
+    int lowerBound = -1;           // LowerBounds::best; bestMakespan buna eşitse optimal
+    long long decodes = 0;         // Artımlı çözülen komşu sayısı
+    long long cacheHits = 0;       // Önbellekten okunan komşu sayısı (kazanılan çözme)
+
+    double gapPercent() const { return LowerBounds::gapPercent(bestMakespan, lowerBound); }
+    double cacheHitRate() const {
+        return cacheHits > 0 ? static_cast<double>(cacheHits) / (cacheHits + decodes) : 0.0;
+    }
+};
+
+/**
+ * SimulatedAnnealing: Kritik bloklardaki swap ve ekleme hamleleri üzerinde
+ * benzetimli tavlama.
+ *
+ * Her iterasyonda izlenen kritik yolun rastgele bir bloğundan bir hamle seçilir
+ * (bitişik swap ya da bloğun içinde/ucuna ekleme), tek çalışma çizelgesine
+ * artımlı uygulanır ve Metropolis ölçütüyle kabul edilmezse geri alınır.
+ * Çizelge kopyası sadece en iyi çözümden uzaklaşılırken alınır.
+ *
+ * Süre bütçesi kesindir: dolduğunda o ana kadarki en iyi çizelge döner.
+ * Makespan alt sınıra (LowerBounds) ulaşınca arama durur.
+ * Aynı seed ve iterasyon sınırıyla deterministiktir (süre sınırı hariç).
+ * Aynı nesne aynı anda birden fazla iş parçacığından kullanılmamalıdır.
+ */
+class SimulatedAnnealing {
+private:
+    const ProblemInstance& instance_;
+    mutable std::vector<int> path_;
+    mutable std::vector<CriticalBlock> blocks_;
+
+public:
+    /**
+     * @param instance Problem örneği
+     */
+    explicit SimulatedAnnealing(const ProblemInstance& instance);
+
+    /**
+     * Başlangıç çizelgesinden tavlamayı çalıştırır.
+     *
+     * @param initialSchedule Başlangıç çizelgesi (çözülmemişse çözülür)
+     * @param options Ayarlar
+     * @return En iyi çizelge; başlangıç çözülemezse bestMakespan = -1
+     */
+    AnnealingResult run(const Schedule& initialSchedule,
+                        const AnnealingOptions& options = AnnealingOptions()) const;
+};
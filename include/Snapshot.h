@@ -0,0 +1,174 @@
+#pragma once
+
+#include "Models.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+/**
+ * İkili anlık görüntü (snapshot) dosya başlığı. Tüm dosyalar bu sabit boyutlu
+ * başlıkla başlar; bölümler 8 bayta hizalı yoğun int32 dizileridir ve
+ * sectionOffset ile dosya başından itibaren adreslenir.
+ *
+ * Sürüm 1 düzeni:
+ * - Instance: jobOffset[J+1], opJob[N], opMachine[N], opDuration[N],
+ *             jobTotalTime[J], remainingWork[N], machineOpCount[M],
+ *             dize tablosu (uint32 ofsetler[J+M+1] + karakterler; önce işler, sonra makineler)
+ * - Schedule: machineOffset[M+1], sequence[S], startTime[N], endTime[N]
+ */
+struct SnapshotHeader {
+    char magic[8];                 // "JSSPSNAP"
+    std::uint32_t version;
+    std::uint32_t kind;            // SnapshotKind
+    std::uint32_t byteOrder;       // Yazanın bayt sırasında 0x01020304
+    std::uint32_t headerSize;
+    std::uint64_t fileSize;
+    std::uint64_t fingerprint;     // Instance parmak izi (çizelge ile eşleştirme için)
+    std::int32_t numJobs;
+    std::int32_t numMachines;
+    std::int32_t numOps;
+    std::int32_t numSequenced;     // Schedule: sequence uzunluğu
+    std::int32_t makespan;         // Schedule: çözülmüşse makespan, aksi halde -1
+    std::int32_t makespanOp;
+    std::uint32_t sectionCount;
+    std::uint32_t reserved;
+    std::uint64_t sectionOffset[8];
+};
+
+enum class SnapshotKind : std::uint32_t {
+    Instance = 1,
+    Schedule = 2
+};
+
+/**
+ * MappedFile: Salt okunur bellek eşlemeli (mmap) dosya.
+ */
+class MappedFile {
+private:
+    const unsigned char* data_ = nullptr;
+    std::size_t size_ = 0;
+
+public:
+    MappedFile() = default;
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * Dosyayı eşler.
+     *
+     * @param path Dosya yolu
+     * @throws std::runtime_error açılamaz veya eşlenemezse
+     */
+    explicit MappedFile(const std::string& path);
+
+    const unsigned char* data() const { return data_; }
+    std::size_t size() const { return size_; }
+};
+
+/**
+ * MappedInstance: Bir instance anlık görüntüsü üzerinde sıfır kopyalı görünüm.
+ *
+ * Açılışta başlık, bölüm sınırları, indeks aralıkları, kimlik tekilliği ve
+ * türetilmiş dizilerin (iş toplamı, kalan iş, makine başına işlem sayısı)
+ * birincil dizilerle tutarlılığı tek geçişte doğrulanır; diziler doğrudan
+ * eşlenen bellekten okunur. Çözücüler için bir
+ * ProblemInstance gerekiyorsa toProblemInstance() yoğun dizileri toplu
+ * kopyalar ve compile() adımını (sıralama, sayma) atlar.
+ */
+class MappedInstance {
+private:
+    MappedFile file_;
+    const SnapshotHeader* header_ = nullptr;
+
+    const std::int32_t* section(int index) const {
+        return reinterpret_cast<const std::int32_t*>(file_.data() + header_->sectionOffset[index]);
+    }
+
+    const std::uint32_t* stringOffsets() const {
+        return reinterpret_cast<const std::uint32_t*>(section(7));
+    }
+
+    std::string_view stringAt(int index) const;
+
+public:
+    /**
+     * @param path Instance anlık görüntüsü
+     * @throws std::runtime_error dosya geçersizse ("Snapshot error: ...")
+     */
+    explicit MappedInstance(const std::string& path);
+
+    int numJobs() const { return header_->numJobs; }
+    int numMachines() const { return header_->numMachines; }
+    int numOps() const { return header_->numOps; }
+    std::uint64_t fingerprint() const { return header_->fingerprint; }
+
+    const std::int32_t* jobOffset() const { return section(0); }
+    const std::int32_t* opJob() const { return section(1); }
+    const std::int32_t* opMachine() const { return section(2); }
+    const std::int32_t* opDuration() const { return section(3); }
+    const std::int32_t* jobTotalTime() const { return section(4); }
+    const std::int32_t* remainingWork() const { return section(5); }
+    const std::int32_t* machineOpCount() const { return section(6); }
+
+    std::string_view jobId(int job) const { return stringAt(job); }
+    std::string_view machineId(int machine) const { return stringAt(numJobs() + machine); }
+
+    /**
+     * Çözücülerin kullanabileceği bir ProblemInstance oluşturur (yoğun görünüm hazır gelir).
+     */
+    ProblemInstance toProblemInstance() const;
+};
+
+/**
+ * Snapshot: ProblemInstance ve Schedule için sürümlü ikili anlık görüntüler
+ * ve mevcut JSON biçimine dönüştürme.
+ *
+ * Tüm fonksiyonlar G/Ç veya biçim hatalarında std::runtime_error fırlatır.
+ */
+class Snapshot {
+public:
+    static constexpr std::uint32_t kVersion = 1;
+
+    /**
+     * Yoğun görünümün parmak izi (FNV-1a): id'ler, iş sınırları, makineler ve süreler.
+     * Bir çizelge anlık görüntüsünün hangi instance'a ait olduğunu doğrular.
+     */
+    static std::uint64_t fingerprint(const CompiledInstance& ci);
+
+    /**
+     * Instance anlık görüntüsü yazar.
+     *
+     * @param instance Problem örneği
+     * @param path Çıktı dosyası
+     */
+    static void writeInstance(const ProblemInstance& instance, const std::string& path);
+
+    /**
+     * Çizelge anlık görüntüsü yazar (makine sıraları ve varsa zamanlar).
+     *
+     * @param schedule Çizelge (layout ayarlı olmalı)
+     * @param path Çıktı dosyası
+     */
+    static void writeSchedule(const Schedule& schedule, const std::string& path);
+
+    /**
+     * Çizelge anlık görüntüsünü okur; instance'ın parmak izi eşleşmelidir.
+     * Zamanlar ve makespan dosyadakiyle aynıdır (yeniden çözme gerekmez).
+     *
+     * @param instance Çizelgenin ait olduğu problem örneği
+     * @param path Çizelge anlık görüntüsü
+     * @return instance.compiled() düzenine bağlı çizelge
+     */
+    static Schedule readSchedule(const ProblemInstance& instance, const std::string& path);
+
+    /**
+     * Instance'ı InputParser'ın okuduğu JSON biçiminde yazar (işler id sırasıyla).
+     *
+     * @param instance Problem örneği
+     * @param path Çıktı dosyası
+     */
+    static void writeInstanceJson(const ProblemInstance& instance, const std::string& path);
+};
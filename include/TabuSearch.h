@@ -0,0 +1,112 @@
+#pragma once
+
+#include "Models.h"
+#include "ScheduleDecoder.h"
+#include "MakespanCalculator.h"
+#include "Move.h"
+#include "CriticalPathAnalyzer.h"
+#include "Cancellation.h"
+#include "LowerBounds.h"
+#include "EvaluationCache.h"
+#include <functional>
+#include <memory>
+#include <vector>
+
+/**
+ * Tabu aramasının kullandığı kritik blok komşuluğu.
+ */
+enum class TabuNeighborhood {
+    N5,  // Nowicki–Smutnicki: blok uçlarındaki bitişik çiftlerin swap'ı
+    N6   // Balas–Vazacopoulos: blok içindeki işlemi bloğun başına/sonuna taşıma (N5'i kapsar)
+};
+
+/**
+ * TabuOptions: Tabu arama ayarları.
+ */
+struct TabuOptions {
+    TabuNeighborhood neighborhood = TabuNeighborhood::N5;
+    long long maxIterations = 100000;  // Toplam iterasyon sınırı
+    double timeLimitSeconds = 0.0;     // <= 0: süre sınırı yok
+    int tabuTenure = 8;                // Ters çevrilen bir sıranın yasaklı kaldığı en az iterasyon
+    int tenureSpread = 4;              // Süreye eklenen rastgele pay: [0, spread]
+    int maxStagnation = 2000;          // En iyi iyileşmeden bu kadar iterasyon sonra yeniden başla
+    int eliteSize = 5;                 // Yeniden başlatma havuzundaki en iyi çözüm sayısı
+    int perturbationMoves = 2;         // Yeniden başlatmada uygulanan rastgele kritik hamle sayısı
+    int targetMakespan = -1;           // Bu değere ulaşılınca dur (< 0: yok)
+    unsigned seed = 1;
+    CancellationToken cancel;          // İptal edilince en iyi çözümle dön
+    // Her yeni en iyi çözümde çağrılır (çizelge sadece çağrı süresince geçerlidir)
+    std::function<void(const Schedule& schedule, int makespan)> onImprovement;
+    // Komşu makespan önbelleği (nullptr: kapalı); seçilen hamle uygulanırken doğrulanır,
+    // sonucu sadece özet çakışmasında değişebilir (bkz. EvaluationCache)
+    std::shared_ptr<EvaluationCache> cache;
+};
+
+/**
+ * TabuResult: Tabu aramasının sonucu.
+ */
+struct TabuResult {
+    Schedule best;
+    int bestMakespan = -1;
+    int initialMakespan = -1;
+    long long iterations = 0;
+    int restarts = 0;
+    double wallSeconds = 0.0;
+    bool cancelled = false;
+    int lowerBound = -1;           // LowerBounds::best; bestMakespan buna eşitse optimal
+    long long decodes = 0;         // Artımlı çözülen komşu sayısı
+    long long cacheHits = 0;       // Önbellekten okunan komşu sayısı (kazanılan çözme)
+
+    double gapPercent() const { return LowerBounds::gapPercent(bestMakespan, lowerBound); }
+    double cacheHitRate() const {
+        return cacheHits > 0 ? static_cast<double>(cacheHits) / (cacheHits + decodes) : 0.0;
+    }
+};
+
+/**
+ * TabuSearch: Kritik blok komşulukları üzerinde Nowicki–Smutnicki tarzı tabu arama.
+ *
+ * Her iterasyonda kritik yol izlenir ve bloklarından hamleler üretilir; her
+ * hamle tek çalışma çizelgesi üzerinde artımlı olarak uygulanıp geri alınır.
+ * Tabu listesi ters çevrilen işlem çiftleriyle anahtarlanır: bir hamle, yakın
+ * zamanda bozulan bir "a, b'den önce" sırasını geri getiriyorsa yasaktır, ancak
+ * en iyi çözümü iyileştiriyorsa (aspirasyon) kabul edilir. Uzun süre iyileşme
+ * olmazsa elit havuzundan bir çözüme geri dönülür. Makespan alt sınıra
+ * (LowerBounds) ulaşınca arama durur.
+ *
+ * Sonuç, aynı seed ve iterasyon sınırıyla deterministiktir (süre sınırı hariç).
+ * Aynı TabuSearch nesnesi aynı anda birden fazla iş parçacığından kullanılmamalıdır.
+ */
+class TabuSearch {
+private:
+    const ProblemInstance& instance_;
+    mutable std::vector<int> tails_; // N6 koşulları için kuyruk değerleri
+    mutable std::vector<int> path_;
+    mutable std::vector<CriticalBlock> blocks_;
+
+    /**
+     * Kritik yolu izler ve seçili komşuluğun hamlelerini üretir.
+     *
+     * @param schedule Çözülmüş çizelge
+     * @param neighborhood Komşuluk
+     * @param moves Çıktı: aday hamleler (temizlenip doldurulur)
+     */
+    void collectMoves(const Schedule& schedule, TabuNeighborhood neighborhood,
+                      std::vector<InsertMove>& moves) const;
+
+public:
+    /**
+     * @param instance Problem örneği
+     */
+    explicit TabuSearch(const ProblemInstance& instance);
+
+    /**
+     * Başlangıç çizelgesinden tabu aramayı çalıştırır.
+     *
+     * @param initialSchedule Başlangıç çizelgesi (çözülmemişse çözülür)
+     * @param options Ayarlar
+     * @return En iyi çizelge; başlangıç çözülemezse bestMakespan = -1
+     */
+    TabuResult run(const Schedule& initialSchedule,
+                   const TabuOptions& options = TabuOptions()) const;
+};
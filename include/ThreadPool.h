@@ -0,0 +1,91 @@
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * FunctionRef: Çağrılabilir bir nesneye sahiplenmeyen, ayırma yapmayan referans.
+ *
+ * std::function yakaladığı lambdayı (küçük nesne sınırını aşarsa) yığına
+ * kopyalar; FunctionRef sadece adresini ve bir çağırma işaretçisini tutar.
+ * Başvurulan nesne FunctionRef kullanıldığı sürece yaşamalıdır, bu yüzden
+ * sadece senkron çağrılan parametreler için uygundur.
+ */
+template <typename Signature>
+class FunctionRef;
+
+template <typename R, typename... Args>
+class FunctionRef<R(Args...)> {
+private:
+    void* object_;
+    R (*call_)(void*, Args...);
+
+public:
+    template <typename F,
+              typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, FunctionRef>>>
+    FunctionRef(F&& fn)
+        : object_(const_cast<void*>(static_cast<const void*>(std::addressof(fn)))),
+          call_([](void* object, Args... args) -> R {
+              return (*static_cast<std::remove_reference_t<F>*>(object))(std::forward<Args>(args)...);
+          }) {}
+
+    R operator()(Args... args) const { return call_(object_, std::forward<Args>(args)...); }
+};
+
+/**
+ * ThreadPool: Sabit sayıda kalıcı iş parçacığı ile paralel görev çalıştırır.
+ *
+ * Çağıran iş parçacığı 0 numaralı işçi olarak katılır; böylece tek iş
+ * parçacıklı havuz hiç ek iş parçacığı oluşturmaz. Görevler çağrı başına
+ * senkron çalışır (run/parallelFor tüm işçiler bitince döner), bu yüzden
+ * görevler FunctionRef ile alınır ve çağrı başına yığın ayırması yapılmaz.
+ * Bir işçide atılan ilk istisna çağırana yeniden fırlatılır.
+ */
+class ThreadPool {
+private:
+    std::vector<std::thread> threads_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    const FunctionRef<void(int)>* task_ = nullptr;
+    unsigned long generation_ = 0;
+    int pending_ = 0;
+    bool stopping_ = false;
+    std::exception_ptr error_;
+
+    void workerLoop(int worker);
+
+public:
+    /**
+     * @param threadCount İşçi sayısı (çağıran dahil); <= 0 ise donanım iş parçacığı sayısı
+     */
+    explicit ThreadPool(int threadCount);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    int size() const { return static_cast<int>(threads_.size()) + 1; }
+
+    /**
+     * fn(worker) fonksiyonunu her işçide bir kez çalıştırır ve hepsinin bitmesini bekler.
+     * 
+     * @param fn İşçi indeksi (0..size()-1) alan görev
+     */
+    void run(FunctionRef<void(int worker)> fn);
+
+    /**
+     * [0, n) aralığını işçiler arasında ardışık parçalara böler.
+     * Parça sınırları sadece n ve size()'a bağlıdır (deterministik).
+     * 
+     * @param n Eleman sayısı
+     * @param fn fn(worker, begin, end) — boş parçalar için çağrılmaz
+     */
+    void parallelFor(int n, FunctionRef<void(int worker, int begin, int end)> fn);
+};
@@ -0,0 +1,16 @@
+#include "AllocationCounter.h"
+
+namespace {
+
+// Sabit başlatmalı: operator new iş parçacığı başlarken de güvenle çağrılabilir
+thread_local long long allocations = 0;
+
+} // namespace
+
+long long AllocationCounter::count() {
+    return allocations;
+}
+
+void AllocationCounter::record() noexcept {
+    ++allocations;
+}
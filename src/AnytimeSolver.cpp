@@ -0,0 +1,147 @@
+#include "AnytimeSolver.h"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+bool BestSolutionSlot::offer(const Schedule& schedule, int makespan) {
+    int current = makespan_.load(std::memory_order_relaxed);
+    if (makespan < 0 || (current >= 0 && makespan >= current)) {
+        return false;
+    }
+    // Kopya kilit dışında yapılır; kilit altında sadece işaretçiler değişir
+    std::shared_ptr<const Schedule> published = std::make_shared<Schedule>(schedule);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        schedule_.swap(published);
+    }
+    // Önce çizelge, sonra makespan/sürüm: makespan'ı gören okuyucu en az o kadar iyi bir çizelge yükler
+    makespan_.store(makespan, std::memory_order_release);
+    version_.fetch_add(1, std::memory_order_release);
+    return true; // Eski çizelge (published) burada, kilit dışında bırakılır
+}
+
+std::shared_ptr<const Schedule> BestSolutionSlot::load() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return schedule_;
+}
+
+std::shared_ptr<const Schedule> BestSolutionSlot::loadIfNewer(unsigned& seenVersion) const {
+    unsigned current = version_.load(std::memory_order_acquire);
+    if (current == seenVersion) {
+        return nullptr;
+    }
+    seenVersion = current;
+    return load();
+}
+
+AnytimeSolver::AnytimeSolver(const ProblemInstance& instance)
+    : instance_(instance) {
+}
+
+AnytimeResult AnytimeSolver::solve(const AnytimeOptions& options) const {
+    auto started = std::chrono::steady_clock::now();
+    auto elapsed = [&]() {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    };
+    const bool hasDeadline = options.timeLimitSeconds > 0.0;
+
+    AnytimeResult result;
+    result.lowerBound = LowerBounds::best(instance_);
+    auto publish = [&](const Schedule& schedule, int makespan, const char* source) {
+        if (makespan < 0 || (result.bestMakespan >= 0 && makespan >= result.bestMakespan)) {
+            return false;
+        }
+        double seconds = elapsed();
+        result.bestMakespan = makespan;
+        result.bestSource = source;
+        ++result.improvements;
+        if (result.firstSolutionSeconds < 0.0) {
+            result.firstSolutionSeconds = seconds;
+        }
+        if (options.slot) {
+            options.slot->offer(schedule, makespan);
+        }
+        if (options.onImprovement) {
+            options.onImprovement(AnytimeUpdate{schedule, makespan, seconds, source});
+        }
+        return true;
+    };
+    auto stopReason = [&](AnytimeStop fallback) {
+        if (options.cancel.isCancelled()) return AnytimeStop::Cancelled;
+        if (result.bestMakespan >= 0 && result.bestMakespan <= result.lowerBound) {
+            return AnytimeStop::LowerBoundReached;
+        }
+        if (options.targetMakespan >= 0 && result.bestMakespan >= 0 &&
+            result.bestMakespan <= options.targetMakespan) {
+            return AnytimeStop::TargetReached;
+        }
+        if (hasDeadline && elapsed() >= options.timeLimitSeconds) return AnytimeStop::Deadline;
+        return fallback;
+    };
+
+    // Aşama 1: dağıtım kuralları; ilk kural her durumda çalışır, böylece geçerli bir çizelge döner
+    DispatchHeuristics heuristics(instance_);
+    for (DispatchHeuristics::Rule rule : DispatchHeuristics::allRules()) {
+        if (result.bestMakespan >= 0 && stopReason(AnytimeStop::Exhausted) != AnytimeStop::Exhausted) {
+            break;
+        }
+        Schedule schedule = heuristics.buildSchedule(rule);
+        if (publish(schedule, schedule.makespan, DispatchHeuristics::ruleName(rule))) {
+            result.best = std::move(schedule);
+        }
+    }
+
+    AnytimeStop stop = stopReason(AnytimeStop::Exhausted);
+    if (stop != AnytimeStop::Exhausted || result.bestMakespan < 0) {
+        result.stop = stop;
+        result.wallSeconds = elapsed();
+        return result;
+    }
+
+    // Aşama 2: kalan sürede en iyi çizelgeden iyileştirme motoru
+    // Kalan süre pozitif tutulur (motorlarda <= 0 "sınırsız" demektir)
+    const double remaining = hasDeadline ? std::max(1e-6, options.timeLimitSeconds - elapsed()) : 0.0;
+    if (options.engine == AnytimeEngine::Tabu) {
+        TabuOptions tabu;
+        tabu.neighborhood = TabuNeighborhood::N6;
+        tabu.maxIterations = std::numeric_limits<long long>::max();
+        tabu.timeLimitSeconds = remaining;
+        tabu.targetMakespan = options.targetMakespan;
+        tabu.seed = options.seed;
+        tabu.cancel = options.cancel;
+        tabu.onImprovement = [&](const Schedule& schedule, int makespan) {
+            publish(schedule, makespan, "Tabu");
+        };
+        TabuResult engine = TabuSearch(instance_).run(result.best, tabu);
+        if (engine.bestMakespan >= 0 && engine.bestMakespan <= result.bestMakespan) {
+            result.best = std::move(engine.best);
+        }
+    } else {
+        AnnealingOptions annealing;
+        annealing.cooling = hasDeadline ? CoolingSchedule::TimeBased : CoolingSchedule::Geometric;
+        annealing.timeLimitSeconds = remaining;
+        annealing.maxIterations = hasDeadline ? 0 : std::numeric_limits<long long>::max();
+        annealing.targetMakespan = options.targetMakespan;
+        annealing.seed = options.seed;
+        annealing.cancel = options.cancel;
+        annealing.onImprovement = [&](const Schedule& schedule, int makespan) {
+            publish(schedule, makespan, "Annealing");
+        };
+        AnnealingResult engine = SimulatedAnnealing(instance_).run(result.best, annealing);
+        if (engine.bestMakespan >= 0 && engine.bestMakespan <= result.bestMakespan) {
+            result.best = std::move(engine.best);
+        }
+    }
+
+    result.stop = stopReason(AnytimeStop::Exhausted);
+    result.wallSeconds = elapsed();
+    return result;
+}
+
+std::future<AnytimeResult> AnytimeSolver::solveAsync(AnytimeOptions options) const {
+    // Yoğun görünüm iş parçacığı başlamadan hazırlanır (tembel derleme thread-safe değil)
+    instance_.compiled();
+    return std::async(std::launch::async, [this, options = std::move(options)]() {
+        return solve(options);
+    });
+}
@@ -0,0 +1,147 @@
+#include "BatchEvaluator.h"
+#include <algorithm>
+#include <stdexcept>
+
+BatchEvaluator::BatchEvaluator(const ProblemInstance& instance)
+    : instance_(instance) {
+    const CompiledInstance& ci = instance_.compiled();
+
+    machineStart_.assign(ci.numMachines() + 1, 0);
+    for (int m = 0; m < ci.numMachines(); ++m) {
+        machineStart_[m + 1] = machineStart_[m] + ci.machineOpCount[m];
+    }
+    jobPredCount_.assign(ci.numOps(), 0);
+    for (int op = 0; op < ci.numOps(); ++op) {
+        jobPredCount_[op] = ci.opIndexOf(op) > 0 ? 1 : 0;
+    }
+}
+
+void BatchEvaluator::setThreadCount(int threads) {
+    if (threads == 1) {
+        pool_.reset();
+    } else {
+        pool_ = std::make_shared<ThreadPool>(threads);
+    }
+    workers_.clear();
+}
+
+int BatchEvaluator::evaluateOne(const int* sequence, Scratch& s) const {
+    const CompiledInstance& ci = instance_.compiled();
+    const int numOps = ci.numOps();
+    const int numMachines = ci.numMachines();
+
+    if (static_cast<int>(s.position.size()) != numOps) {
+        s.position.assign(numOps, -1);
+        s.seenStamp.assign(numOps, 0);
+        s.inDegree.assign(numOps, 0);
+        s.start.assign(numOps, 0);
+        s.ready.reserve(numOps);
+        s.stamp = 0;
+    }
+    if (++s.stamp == 0) {
+        std::fill(s.seenStamp.begin(), s.seenStamp.end(), 0);
+        s.stamp = 1;
+    }
+
+    // Makine kenarları + doğrulama: her bölüm o makinenin işlemlerini birer kez içermeli.
+    // Bölüm boyutları sabit olduğundan bu, işlemlerin tam bir permütasyonu demektir.
+    s.ready.clear();
+    for (int m = 0; m < numMachines; ++m) {
+        const int begin = machineStart_[m];
+        const int end = machineStart_[m + 1];
+        for (int p = begin; p < end; ++p) {
+            int op = sequence[p];
+            if (op < 0 || op >= numOps || ci.opMachine[op] != m || s.seenStamp[op] == s.stamp) {
+                return -1; // Yanlış makine veya tekrarlanan işlem
+            }
+            s.seenStamp[op] = s.stamp;
+            s.position[op] = p;
+            s.start[op] = 0;
+            s.inDegree[op] = jobPredCount_[op] + (p > begin ? 1 : 0);
+            if (s.inDegree[op] == 0) s.ready.push_back(op);
+        }
+    }
+
+    // Topolojik geçiş (ScheduleDecoder::decodeWithStatus ile aynı), sadece başlangıçlar
+    int makespan = 0;
+    int processed = 0;
+    while (!s.ready.empty()) {
+        int op = s.ready.back();
+        s.ready.pop_back();
+        processed++;
+
+        int end = s.start[op] + ci.opDuration[op];
+        makespan = std::max(makespan, end);
+
+        int jobSucc = op + 1;
+        if (jobSucc < numOps && ci.opJob[jobSucc] == ci.opJob[op]) {
+            s.start[jobSucc] = std::max(s.start[jobSucc], end);
+            if (--s.inDegree[jobSucc] == 0) s.ready.push_back(jobSucc);
+        }
+        int pos = s.position[op];
+        if (pos + 1 < machineStart_[ci.opMachine[op] + 1]) {
+            int mSucc = sequence[pos + 1];
+            s.start[mSucc] = std::max(s.start[mSucc], end);
+            if (--s.inDegree[mSucc] == 0) s.ready.push_back(mSucc);
+        }
+    }
+
+    // İşlenmemiş işlem kaldıysa makine sıraları bir döngü oluşturuyor
+    return processed == numOps ? makespan : -1;
+}
+
+void BatchEvaluator::evaluateAll(const std::vector<const int*>& sequences, int* makespans) const {
+    const int n = static_cast<int>(sequences.size());
+    auto runRange = [&](Scratch& scratch, int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            makespans[i] = sequences[i] ? evaluateOne(sequences[i], scratch) : -1;
+        }
+    };
+
+    // Az aday için iş parçacığı senkronizasyonu kazançtan pahalıdır
+    const int workers = pool_ ? pool_->size() : 1;
+    workers_.resize(workers);
+    if (!pool_ || n < 2 * workers) {
+        runRange(workers_[0], 0, n);
+        return;
+    }
+    pool_->parallelFor(n, [&](int worker, int begin, int end) {
+        runRange(workers_[worker], begin, end);
+    });
+}
+
+void BatchEvaluator::evaluate(const int* sequences, int count, int* makespans) const {
+    const int numOps = this->numOps();
+    std::vector<const int*> pointers(count);
+    for (int i = 0; i < count; ++i) {
+        pointers[i] = sequences + static_cast<size_t>(i) * numOps;
+    }
+    evaluateAll(pointers, makespans);
+}
+
+std::vector<int> BatchEvaluator::evaluate(const std::vector<int>& sequences) const {
+    const int numOps = this->numOps();
+    if (numOps == 0) return {};
+    if (sequences.size() % numOps != 0) {
+        throw std::runtime_error("BatchEvaluator: input size is not a multiple of numOps");
+    }
+    const int count = static_cast<int>(sequences.size() / numOps);
+    std::vector<int> makespans(count, -1);
+    evaluate(sequences.data(), count, makespans.data());
+    return makespans;
+}
+
+std::vector<int> BatchEvaluator::evaluate(const std::vector<Schedule>& schedules) const {
+    const CompiledInstance& ci = instance_.compiled();
+    std::vector<const int*> pointers(schedules.size(), nullptr);
+    for (size_t i = 0; i < schedules.size(); ++i) {
+        const Schedule& s = schedules[i];
+        // Sadece tam sıralı, bu örneğe ait çizelgeler (bölüm sınırları sabit olanlar)
+        if (s.layout == &ci && s.machineOffset == machineStart_) {
+            pointers[i] = s.sequence.data();
+        }
+    }
+    std::vector<int> makespans(schedules.size(), -1);
+    evaluateAll(pointers, makespans.data());
+    return makespans;
+}
@@ -0,0 +1,230 @@
+#include "BenchmarkLoader.h"
+
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+static void require(bool cond, const std::string& msg) {
+    if (!cond) throw std::runtime_error("Benchmark input error: " + msg);
+}
+
+namespace {
+
+// Satırdaki tüm belirteçler tamsayıysa true (boş satır false)
+bool parseIntLine(const std::string& line, std::vector<long long>& out) {
+    out.clear();
+    std::istringstream is(line);
+    std::string token;
+    while (is >> token) {
+        size_t pos = 0;
+        long long value = 0;
+        try {
+            value = std::stoll(token, &pos);
+        } catch (const std::exception&) {
+            return false;
+        }
+        if (pos != token.size()) return false;
+        out.push_back(value);
+    }
+    return !out.empty();
+}
+
+std::vector<std::string> readLines(const std::string& filePath) {
+    std::ifstream in(filePath);
+    require(in.good(), "Cannot open file: " + filePath);
+    std::vector<std::string> lines;
+    std::string line;
+    while (std::getline(in, line)) lines.push_back(line);
+    return lines;
+}
+
+std::string stemOf(const std::string& filePath) {
+    return std::filesystem::path(filePath).stem().string();
+}
+
+// "J03" gibi, sıralama dosya sırasıyla aynı olacak genişlikte
+std::string paddedId(char prefix, int index, int count) {
+    std::string digits = std::to_string(index);
+    size_t width = std::to_string(count > 0 ? count - 1 : 0).size();
+    return std::string(1, prefix) + std::string(width - digits.size(), '0') + digits;
+}
+
+// machines[j][k] (0 tabanlı), durations[j][k] matrislerinden örnek kurar
+ProblemInstance buildInstance(const std::vector<std::vector<long long>>& machines,
+                              const std::vector<std::vector<long long>>& durations,
+                              int numMachines, const std::string& filePath) {
+    ProblemInstance inst;
+    for (int m = 0; m < numMachines; ++m) {
+        std::string mid = paddedId('M', m, numMachines);
+        inst.machines.emplace(mid, std::make_unique<Machine>(mid));
+        inst.intern(mid);  // sırayla: dosyadaki makine numarası = kimlik
+    }
+
+    const int numJobs = static_cast<int>(machines.size());
+    for (int j = 0; j < numJobs; ++j) {
+        std::string jid = paddedId('J', j, numJobs);
+        std::vector<Operation> ops;
+        for (size_t k = 0; k < machines[j].size(); ++k) {
+            long long m = machines[j][k];
+            long long d = durations[j][k];
+            require(m >= 0 && m < numMachines,
+                    filePath + ": machine out of range in job " + std::to_string(j));
+            require(d >= 0, filePath + ": negative duration in job " + std::to_string(j));
+            // Sıfır süreli işlemler atlanır (bazı örneklerde makineyi ziyaret etmeyen işler)
+            if (d == 0) continue;
+            ops.emplace_back(static_cast<int>(ops.size()), static_cast<int>(m), static_cast<int>(d));
+        }
+        require(!ops.empty(), filePath + ": job " + std::to_string(j) + " has no operations");
+        inst.jobs.emplace(jid, std::make_unique<Job>(jid, std::move(ops)));
+    }
+
+    inst.compile();
+    return inst;
+}
+
+} // namespace
+
+BenchmarkInstance BenchmarkLoader::load(const std::string& filePath) {
+    for (const std::string& line : readLines(filePath)) {
+        std::istringstream is(line);
+        std::string first;
+        if (is >> first && first == "Times") {
+            return loadTaillard(filePath);
+        }
+    }
+    return loadOrLibrary(filePath);
+}
+
+BenchmarkInstance BenchmarkLoader::loadOrLibrary(const std::string& filePath) {
+    std::vector<std::string> lines = readLines(filePath);
+    std::vector<long long> values;
+
+    // Açıklama satırlarını atla: boyut satırı tam olarak iki tamsayıdır
+    size_t i = 0;
+    while (i < lines.size() && !(parseIntLine(lines[i], values) && values.size() == 2)) ++i;
+    require(i < lines.size(), filePath + ": missing `jobs machines` line");
+
+    const long long numJobs = values[0];
+    const long long numMachines = values[1];
+    require(numJobs > 0 && numMachines > 0, filePath + ": jobs and machines must be > 0");
+
+    // Kalan tamsayılar: her iş için makine sayısı kadar (makine, süre) çifti
+    std::vector<long long> numbers;
+    for (++i; i < lines.size() && static_cast<long long>(numbers.size()) < numJobs * numMachines * 2;
+         ++i) {
+        if (!parseIntLine(lines[i], values)) continue;
+        numbers.insert(numbers.end(), values.begin(), values.end());
+    }
+    require(static_cast<long long>(numbers.size()) >= numJobs * numMachines * 2,
+            filePath + ": expected " + std::to_string(numJobs * numMachines) + " operations");
+
+    std::vector<std::vector<long long>> machines(numJobs), durations(numJobs);
+    for (long long j = 0; j < numJobs; ++j) {
+        for (long long k = 0; k < numMachines; ++k) {
+            size_t at = static_cast<size_t>((j * numMachines + k) * 2);
+            machines[j].push_back(numbers[at]);
+            durations[j].push_back(numbers[at + 1]);
+        }
+    }
+
+    BenchmarkInstance result;
+    result.name = stemOf(filePath);
+    result.instance = buildInstance(machines, durations, static_cast<int>(numMachines), filePath);
+    return result;
+}
+
+BenchmarkInstance BenchmarkLoader::loadTaillard(const std::string& filePath) {
+    std::vector<std::string> lines = readLines(filePath);
+    std::vector<long long> values;
+    BenchmarkInstance result;
+    result.name = stemOf(filePath);
+
+    // Başlık: "jobs machines [time seed, machine seed, upper bound, lower bound]"
+    size_t i = 0;
+    while (i < lines.size() && !(parseIntLine(lines[i], values) && values.size() >= 2)) ++i;
+    require(i < lines.size(), filePath + ": missing size line");
+
+    const long long numJobs = values[0];
+    const long long numMachines = values[1];
+    require(numJobs > 0 && numMachines > 0, filePath + ": jobs and machines must be > 0");
+    if (values.size() >= 6) {
+        result.bounds.upperBound = static_cast<int>(values[4]);
+        result.bounds.lowerBound = static_cast<int>(values[5]);
+    }
+
+    // "Times" ve "Machines" bölümlerinden birer jobs x machines matrisi oku
+    auto readSection = [&](const std::string& title) {
+        while (i < lines.size()) {
+            std::istringstream is(lines[i++]);
+            std::string first;
+            if (is >> first && first == title) break;
+        }
+        std::vector<std::vector<long long>> rows;
+        while (i < lines.size() && static_cast<long long>(rows.size()) < numJobs) {
+            if (parseIntLine(lines[i++], values)) {
+                require(static_cast<long long>(values.size()) == numMachines,
+                        filePath + ": `" + title + "` row " + std::to_string(rows.size()) +
+                            " must have " + std::to_string(numMachines) + " values");
+                rows.push_back(values);
+            }
+        }
+        require(static_cast<long long>(rows.size()) == numJobs,
+                filePath + ": `" + title + "` section is incomplete");
+        return rows;
+    };
+
+    std::vector<std::vector<long long>> durations = readSection("Times");
+    std::vector<std::vector<long long>> machines = readSection("Machines");
+    for (auto& row : machines) {
+        for (long long& m : row) --m; // Taillard makineleri 1 tabanlıdır
+    }
+
+    result.instance = buildInstance(machines, durations, static_cast<int>(numMachines), filePath);
+    return result;
+}
+
+std::unordered_map<std::string, KnownBounds> BenchmarkLoader::loadBounds(const std::string& filePath) {
+    std::ifstream in(filePath);
+    require(in.good(), "Cannot open file: " + filePath);
+
+    std::unordered_map<std::string, KnownBounds> bounds;
+    std::string line;
+    int lineNo = 0;
+    while (std::getline(in, line)) {
+        ++lineNo;
+        std::istringstream is(line);
+        std::string name;
+        if (!(is >> name) || name[0] == '#') continue;
+
+        KnownBounds b;
+        require(static_cast<bool>(is >> b.lowerBound),
+                filePath + ":" + std::to_string(lineNo) + ": missing bound for " + name);
+        if (!(is >> b.upperBound)) b.upperBound = b.lowerBound; // Tek değer: optimal
+        require(b.lowerBound <= b.upperBound,
+                filePath + ":" + std::to_string(lineNo) + ": lower bound above upper bound");
+        bounds[name] = b;
+    }
+    return bounds;
+}
+
+KnownBounds BenchmarkLoader::builtinBounds(const std::string& name) {
+    // Optimal makespan değerleri (alt sınır = üst sınır)
+    static const std::unordered_map<std::string, int> optimal = {
+        {"ft06", 55},    {"ft10", 930},   {"ft20", 1165},
+        {"la01", 666},   {"la02", 655},   {"la03", 597},   {"la04", 590},   {"la05", 593},
+        {"la06", 926},   {"la07", 890},   {"la08", 863},   {"la09", 951},   {"la10", 958},
+        {"la11", 1222},  {"la12", 1039},  {"la13", 1150},  {"la14", 1292},  {"la15", 1207},
+        {"la16", 945},   {"la17", 784},   {"la18", 848},   {"la19", 842},   {"la20", 902},
+        {"la21", 1046},  {"la22", 927},   {"la23", 1032},  {"la24", 935},   {"la25", 977},
+        {"la26", 1218},  {"la27", 1235},  {"la28", 1216},  {"la29", 1152},  {"la30", 1355},
+        {"la31", 1784},  {"la32", 1850},  {"la33", 1719},  {"la34", 1721},  {"la35", 1888},
+        {"la36", 1268},  {"la37", 1397},  {"la38", 1196},  {"la39", 1233},  {"la40", 1222},
+    };
+
+    auto it = optimal.find(name);
+    if (it == optimal.end()) return KnownBounds();
+    return KnownBounds{it->second, it->second};
+}
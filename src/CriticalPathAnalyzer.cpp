@@ -0,0 +1,77 @@
+#include "CriticalPathAnalyzer.h"
+#include <algorithm>
+
+void CriticalPathAnalyzer::tracePath(const Schedule& schedule, const ProblemInstance& instance,
+                                     std::vector<int>& path, std::vector<CriticalBlock>& blocks) {
+    const CompiledInstance& ci = instance.compiled();
+    path.clear();
+    blocks.clear();
+    if (schedule.makespanOp < 0) {
+        return;
+    }
+
+    // Makespan işleminden geriye: başlangıcı öncülün bitişine eşit olan öncüle geç
+    for (int op = schedule.makespanOp; op >= 0;) {
+        path.push_back(op);
+        int start = schedule.startTime[op];
+        if (start == 0) {
+            break;
+        }
+        int pos = schedule.position[op];
+        if (pos > schedule.machineBegin(ci.opMachine[op]) &&
+            schedule.endTime[schedule.sequence[pos - 1]] == start) {
+            op = schedule.sequence[pos - 1];
+        } else {
+            op = ci.opIndexOf(op) > 0 ? op - 1 : -1;
+        }
+    }
+    std::reverse(path.begin(), path.end());
+
+    // Bloklar: yolda makinede bitişik ardışık işlemler
+    for (int op : path) {
+        int machine = ci.opMachine[op];
+        int pos = schedule.position[op];
+        if (!blocks.empty() && blocks.back().machine == machine && blocks.back().end + 1 == pos) {
+            blocks.back().end = pos;
+        } else {
+            blocks.push_back(CriticalBlock{machine, pos, pos});
+        }
+    }
+}
+
+CriticalPathAnalysis CriticalPathAnalyzer::analyze(const Schedule& schedule,
+                                                   const ProblemInstance& instance) {
+    const CompiledInstance& ci = instance.compiled();
+    CriticalPathAnalysis analysis;
+    if (schedule.layout != &ci || schedule.makespan < 0) {
+        return analysis; // Çözülmemiş
+    }
+
+    analysis.makespan = schedule.makespan;
+    tracePath(schedule, instance, analysis.path, analysis.blocks);
+
+    // Geri geçiş: kuyruklar
+    ScheduleDecoder::computeTails(schedule, instance, analysis.tails);
+
+    const int numOps = ci.numOps();
+    analysis.totalSlack.assign(numOps, -1);
+    analysis.freeSlack.assign(numOps, -1);
+
+    for (int op : schedule.sequence) {
+        int end = schedule.endTime[op];
+        analysis.totalSlack[op] = schedule.makespan - (end + analysis.tails[op]);
+
+        // Ardılların (iş ve makine) en erken başlangıcı; ardıl yoksa makespan
+        int limit = schedule.makespan;
+        if (ci.opIndexOf(op) + 1 < ci.jobLength(ci.opJob[op]) && schedule.isScheduled(op + 1)) {
+            limit = std::min(limit, schedule.startTime[op + 1]);
+        }
+        int pos = schedule.position[op];
+        if (pos + 1 < schedule.machineEnd(ci.opMachine[op])) {
+            limit = std::min(limit, schedule.startTime[schedule.sequence[pos + 1]]);
+        }
+        analysis.freeSlack[op] = limit - end;
+    }
+
+    return analysis;
+}
@@ -0,0 +1,54 @@
+#include "EvaluationCache.h"
+#include <algorithm>
+
+EvaluationCache::EvaluationCache(std::size_t capacity)
+    : shards_(new Shard[kShards]),
+      slotsPerShard_(std::max<std::size_t>(1, (capacity + kShards - 1) / kShards)) {
+    for (std::size_t s = 0; s < kShards; ++s) {
+        shards_[s].entries.resize(slotsPerShard_);
+    }
+}
+
+bool EvaluationCache::lookup(std::uint64_t hash, int& makespan) const {
+    lookups_.fetch_add(1, std::memory_order_relaxed);
+    Shard& shard = shardOf(hash);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    const Entry& entry = shard.entries[slotOf(hash)];
+    if (!entry.used || entry.hash != hash) {
+        return false;
+    }
+    makespan = entry.makespan;
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void EvaluationCache::insert(std::uint64_t hash, int makespan) {
+    Shard& shard = shardOf(hash);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    Entry& entry = shard.entries[slotOf(hash)];
+    if (entry.used && entry.hash != hash) {
+        evictions_.fetch_add(1, std::memory_order_relaxed);
+    }
+    entry = Entry{hash, makespan, true};
+    inserts_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void EvaluationCache::clear() {
+    for (std::size_t s = 0; s < kShards; ++s) {
+        std::lock_guard<std::mutex> lock(shards_[s].mutex);
+        std::fill(shards_[s].entries.begin(), shards_[s].entries.end(), Entry());
+    }
+    lookups_.store(0, std::memory_order_relaxed);
+    hits_.store(0, std::memory_order_relaxed);
+    inserts_.store(0, std::memory_order_relaxed);
+    evictions_.store(0, std::memory_order_relaxed);
+}
+
+EvaluationCacheStats EvaluationCache::stats() const {
+    EvaluationCacheStats out;
+    out.lookups = lookups_.load(std::memory_order_relaxed);
+    out.hits = hits_.load(std::memory_order_relaxed);
+    out.inserts = inserts_.load(std::memory_order_relaxed);
+    out.evictions = evictions_.load(std::memory_order_relaxed);
+    return out;
+}
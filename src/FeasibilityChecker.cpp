@@ -1,78 +1,114 @@
 #include "FeasibilityChecker.h"
-#include <algorithm>
-#include <vector>
+#include <sstream>
 
-bool FeasibilityChecker::isValid(const Schedule& schedule, const ProblemInstance& instance) {
-    // Kontrol 1: İş öncelik kısıtı
-    // Her iş için, işlemler sırayla olmalı: Op[j][k+1], Op[j][k] bitmeden başlayamaz
-    for (const auto& [jobId, opTimes] : schedule.opTimes) {
-        const Job* job = instance.getJob(jobId);
-        if (!job) {
-            return false; // Geçersiz iş referansı
-        }
+namespace {
 
-        const std::vector<Operation>& ops = job->operations();
-        
-        // Her ardışık işlem çiftini kontrol et
-        for (int i = 0; i < static_cast<int>(ops.size()) - 1; ++i) {
-            auto it1 = opTimes.find(i);
-            auto it2 = opTimes.find(i + 1);
+// Tüm kontroller; her ihlal report() ile bildirilir, report false dönerse
+// tarama durur. isValid ve diagnose aynı geçişi paylaşır.
+template <typename Report>
+void check(const Schedule& schedule, const CompiledInstance& ci, Report&& report) {
+    if (schedule.layout != &ci ||
+        schedule.numMachines() != ci.numMachines() ||
+        static_cast<int>(schedule.endTime.size()) != ci.numOps()) {
+        report(Violation{ViolationKind::LayoutMismatch, -1, -1, -1});
+        return; // Çizelge bu örneğe ait değil
+    }
 
-            if (it1 == opTimes.end() || it2 == opTimes.end()) {
-                return false; // Eksik işlem zamanları
-            }
+    // Kontrol 1: İş öncelik kısıtı, işlemler üzerinde tek geçiş.
+    // Bir işin işlemleri ya hiç çizelgelenmemiştir (atlanır) ya da hepsi çizelgelenmiştir;
+    // ardışık iki işlemden yalnızca biri zamanlıysa eksik olan raporlanır.
+    for (int op = 1; op < ci.numOps(); ++op) {
+        if (ci.opJob[op] != ci.opJob[op - 1]) continue; // İşin ilk işlemi
 
-            // İşlem i+1, işlem i bittikten sonra başlamalı
-            if (it2->second.start < it1->second.end) {
-                return false; // Öncelik ihlali
-            }
+        bool scheduled = schedule.isScheduled(op);
+        if (scheduled != schedule.isScheduled(op - 1)) {
+            int missing = scheduled ? op - 1 : op;
+            if (!report(Violation{ViolationKind::MissingOperation, missing, -1, -1})) return;
+        } else if (scheduled && schedule.startTime[op] < schedule.endTime[op - 1]) {
+            if (!report(Violation{ViolationKind::Precedence, op, op - 1, -1})) return;
         }
     }
 
-    // Kontrol 2: Makine kısıtı
-    // Her makinede, işlemler çakışmamalı ve sıralı olmalı
-    for (const auto& [machineId, opSequence] : schedule.machineOrder) {
-        if (opSequence.empty()) {
-            continue;
-        }
+    // Kontrol 2: Makine kısıtı, makine sıraları üzerinde tek geçiş
+    for (int m = 0; m < ci.numMachines(); ++m) {
+        int prev = -1; // Bu makinede zamanı olan son işlem
+        for (int p = schedule.machineBegin(m); p < schedule.machineEnd(m); ++p) {
+            int op = schedule.sequence[p];
 
-        // Bu makinedeki tüm işlemleri zaman pencereleriyle birlikte topla
-        std::vector<std::pair<OpKey, TimeWindow>> machineOps;
-        for (const OpKey& opKey : opSequence) {
-            auto jobIt = schedule.opTimes.find(opKey.jobId);
-            if (jobIt == schedule.opTimes.end()) {
-                return false; // Eksik iş zamanları
-            }
-
-            auto opIt = jobIt->second.find(opKey.opIndex);
-            if (opIt == jobIt->second.end()) {
-                return false; // Eksik işlem zamanları
-            }
-
-            // İşlemin doğru makinede olduğunu doğrula
-            const Job* job = instance.getJob(opKey.jobId);
-            if (!job) {
-                return false;
-            }
-            const std::vector<Operation>& ops = job->operations();
-            if (opKey.opIndex < 0 || opKey.opIndex >= static_cast<int>(ops.size())) {
-                return false;
+            if (ci.opMachine[op] != m) {
+                if (!report(Violation{ViolationKind::WrongMachine, op, -1, m})) return;
             }
-            if (ops[opKey.opIndex].machineId() != machineId) {
-                return false; // İşlem yanlış makineye atanmış
+            if (!schedule.isScheduled(op)) {
+                // İş kontrolü aynı işlemi zaten raporladıysa tekrarlama
+                bool partialJob =
+                    (op > ci.jobOffset[ci.opJob[op]] && schedule.isScheduled(op - 1)) ||
+                    (op + 1 < ci.jobOffset[ci.opJob[op] + 1] && schedule.isScheduled(op + 1));
+                if (!partialJob &&
+                    !report(Violation{ViolationKind::MissingOperation, op, -1, m})) {
+                    return;
+                }
+                continue;
             }
 
-            machineOps.push_back({opKey, opIt->second});
-        }
-
-        // Çakışmaları kontrol et: işlemler sıralı olmalı (sonraki başlangıç >= önceki bitiş)
-        for (size_t i = 0; i < machineOps.size() - 1; ++i) {
-            if (machineOps[i + 1].second.start < machineOps[i].second.end) {
-                return false; // Aynı makinede çakışan işlemler
+            // Çakışma: sonraki başlangıç >= önceki bitiş olmalı
+            if (prev >= 0 && schedule.startTime[op] < schedule.endTime[prev]) {
+                if (!report(Violation{ViolationKind::MachineOverlap, op, prev, m})) return;
             }
+            prev = op;
         }
     }
+}
 
-    return true;
+std::string opName(const CompiledInstance& ci, int op) {
+    return ci.jobIds[ci.opJob[op]] + "#" + std::to_string(ci.opIndexOf(op));
 }
 
+} // namespace
+
+bool FeasibilityChecker::isValid(const Schedule& schedule, const ProblemInstance& instance) {
+    bool valid = true;
+    check(schedule, instance.compiled(), [&](const Violation&) {
+        valid = false;
+        return false; // İlk ihlalde dur
+    });
+    return valid;
+}
+
+FeasibilityReport FeasibilityChecker::diagnose(const Schedule& schedule,
+                                               const ProblemInstance& instance) {
+    FeasibilityReport report;
+    check(schedule, instance.compiled(), [&](const Violation& v) {
+        report.violations.push_back(v);
+        return true;
+    });
+    return report;
+}
+
+std::string FeasibilityChecker::describe(const Violation& v, const Schedule& schedule,
+                                         const ProblemInstance& instance) {
+    const CompiledInstance& ci = instance.compiled();
+    std::ostringstream os;
+    switch (v.kind) {
+    case ViolationKind::LayoutMismatch:
+        os << "layout mismatch: schedule does not belong to this instance";
+        break;
+    case ViolationKind::Precedence:
+        os << "precedence: " << opName(ci, v.op) << " starts at " << schedule.startTime[v.op]
+           << " before " << opName(ci, v.otherOp) << " ends at " << schedule.endTime[v.otherOp];
+        break;
+    case ViolationKind::MachineOverlap:
+        os << "overlap on " << ci.machineIds[v.machine] << ": " << opName(ci, v.op)
+           << " starts at " << schedule.startTime[v.op] << " before " << opName(ci, v.otherOp)
+           << " ends at " << schedule.endTime[v.otherOp];
+        break;
+    case ViolationKind::WrongMachine:
+        os << "wrong machine: " << opName(ci, v.op) << " requires "
+           << ci.machineIds[ci.opMachine[v.op]] << " but is sequenced on "
+           << ci.machineIds[v.machine];
+        break;
+    case ViolationKind::MissingOperation:
+        os << "missing: " << opName(ci, v.op) << " has no start/end time";
+        break;
+    }
+    return os.str();
+}
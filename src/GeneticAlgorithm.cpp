@@ -0,0 +1,270 @@
+#include "GeneticAlgorithm.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <memory>
+#include <numeric>
+#include <random>
+
+namespace {
+
+struct Individual {
+    std::vector<int> chromosome;
+    Schedule schedule;
+    int makespan = INT_MAX;
+};
+
+// Kromozomdan öncelikler: işin k. geçişi işin k. işlemidir, önceliği gen konumudur
+void chromosomePriority(const CompiledInstance& ci, const std::vector<int>& chromosome,
+                        std::vector<int>& priority) {
+    std::vector<int> next(ci.jobOffset.begin(), ci.jobOffset.end() - 1);
+    priority.assign(ci.numOps(), 0);
+    for (int i = 0; i < static_cast<int>(chromosome.size()); ++i) {
+        priority[next[chromosome[i]]++] = i;
+    }
+}
+
+// Seçili işlerin genleri p1'deki konumlarında kalır, boşluklar p2'deki diğer genlerle sırayla dolar
+std::vector<int> poxCrossover(const std::vector<int>& p1, const std::vector<int>& p2,
+                              const std::vector<char>& selected) {
+    std::vector<int> child(p1.size());
+    size_t from = 0;
+    for (size_t i = 0; i < p1.size(); ++i) {
+        if (selected[p1[i]]) {
+            child[i] = p1[i];
+            continue;
+        }
+        while (selected[p2[from]]) ++from;
+        child[i] = p2[from++];
+    }
+    return child;
+}
+
+// Aynı işlem her makinenin sırası üzerinde; çocuk sıradaki indeks öncelik olur
+void joxPriority(const CompiledInstance& ci, const Schedule& s1, const Schedule& s2,
+                 const std::vector<char>& selected, std::vector<int>& priority) {
+    priority.assign(ci.numOps(), 0);
+    for (int m = 0; m < ci.numMachines(); ++m) {
+        int from = s2.machineBegin(m);
+        for (int p = s1.machineBegin(m); p < s1.machineEnd(m); ++p) {
+            int op = s1.sequence[p];
+            if (!selected[ci.opJob[op]]) {
+                while (selected[ci.opJob[s2.sequence[from]]]) ++from;
+                op = s2.sequence[from++];
+            }
+            priority[op] = p;
+        }
+    }
+}
+
+// Farklı işlerin iki genini değiştir ya da bir geni başka konuma taşı
+void mutateChromosome(std::vector<int>& chromosome, std::mt19937& rng) {
+    const int n = static_cast<int>(chromosome.size());
+    if (n < 2) return;
+    int a = static_cast<int>(rng() % n);
+    int b = static_cast<int>(rng() % n);
+    if (rng() % 2 == 0) {
+        std::swap(chromosome[a], chromosome[b]);
+    } else if (a < b) {
+        std::rotate(chromosome.begin() + a, chromosome.begin() + a + 1, chromosome.begin() + b + 1);
+    } else {
+        std::rotate(chromosome.begin() + b, chromosome.begin() + a, chromosome.begin() + a + 1);
+    }
+}
+
+// Bir makinede iki işlemin önceliklerini değiştir (JOX çocukları için makine sırası mutasyonu)
+void mutatePriority(const CompiledInstance& ci, const Schedule& layout,
+                    std::vector<int>& priority, std::mt19937& rng) {
+    int m = static_cast<int>(rng() % ci.numMachines());
+    int size = layout.machineSize(m);
+    if (size < 2) return;
+    int a = layout.sequence[layout.machineBegin(m) + static_cast<int>(rng() % size)];
+    int b = layout.sequence[layout.machineBegin(m) + static_cast<int>(rng() % size)];
+    std::swap(priority[a], priority[b]);
+}
+
+} // namespace
+
+GeneticAlgorithm::GeneticAlgorithm(const ProblemInstance& instance)
+    : instance_(instance), heuristics_(instance) {
+}
+
+Schedule GeneticAlgorithm::decode(const std::vector<int>& chromosome) const {
+    std::vector<int> priority;
+    chromosomePriority(instance_.compiled(), chromosome, priority);
+    return heuristics_.buildSchedule(PriorityListRule{&priority});
+}
+
+std::vector<int> GeneticAlgorithm::encode(const Schedule& schedule) const {
+    const CompiledInstance& ci = instance_.compiled();
+    std::vector<int> ops(ci.numOps());
+    std::iota(ops.begin(), ops.end(), 0);
+    std::sort(ops.begin(), ops.end(), [&](int a, int b) {
+        return schedule.startTime[a] != schedule.startTime[b]
+            ? schedule.startTime[a] < schedule.startTime[b] : a < b;
+    });
+
+    std::vector<int> chromosome(ci.numOps());
+    for (int i = 0; i < ci.numOps(); ++i) {
+        chromosome[i] = ci.opJob[ops[i]];
+    }
+    return chromosome;
+}
+
+GeneticResult GeneticAlgorithm::run(const GeneticOptions& options) const {
+    const CompiledInstance& ci = instance_.compiled();
+    auto started = std::chrono::steady_clock::now();
+    auto elapsed = [&]() {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    };
+
+    GeneticResult result;
+    result.lowerBound = LowerBounds::best(instance_);
+    const int populationSize = std::max(2, options.populationSize);
+    std::unique_ptr<ThreadPool> pool;
+    if (options.threads != 1) {
+        pool = std::make_unique<ThreadPool>(options.threads);
+    }
+    auto parallelFor = [&](int n, FunctionRef<void(int, int)> fn) {
+        if (!pool || n < 2) {
+            for (int i = 0; i < n; ++i) fn(0, i);
+            return;
+        }
+        pool->parallelFor(n, [&](int worker, int begin, int end) {
+            for (int i = begin; i < end; ++i) fn(worker, i);
+        });
+    };
+
+    // Çocuk başına öncelikler seri üretilir, çözme paralel yapılır
+    std::vector<std::vector<int>> priorities;
+    std::vector<Individual> offspring;
+    auto evaluate = [&](int count) {
+        parallelFor(count, [&](int, int i) {
+            Individual& child = offspring[i];
+            child.schedule = heuristics_.buildSchedule(PriorityListRule{&priorities[i]});
+            child.makespan = child.schedule.makespan >= 0 ? child.schedule.makespan : INT_MAX;
+            child.chromosome = encode(child.schedule);
+        });
+        result.evaluations += count;
+    };
+
+    // Başlangıç nüfusu: dağıtım kuralı çizelgeleri ve rastgele karıştırılmış kromozomlar
+    std::mt19937 rng(options.seed);
+    std::vector<int> base;
+    for (int j = 0; j < ci.numJobs(); ++j) {
+        base.insert(base.end(), ci.jobLength(j), j);
+    }
+    priorities.assign(populationSize, {});
+    offspring.assign(populationSize, Individual());
+    int seeded = 0;
+    if (options.seedWithRules) {
+        for (DispatchHeuristics::Rule rule : DispatchHeuristics::allRules()) {
+            if (seeded == populationSize) break;
+            chromosomePriority(ci, encode(heuristics_.buildSchedule(rule)), priorities[seeded++]);
+        }
+    }
+    for (int i = seeded; i < populationSize; ++i) {
+        std::vector<int> chromosome = base;
+        std::shuffle(chromosome.begin(), chromosome.end(), rng);
+        chromosomePriority(ci, chromosome, priorities[i]);
+    }
+    evaluate(populationSize);
+
+    std::vector<Individual> population = std::move(offspring);
+    auto byMakespan = [](const Individual& a, const Individual& b) { return a.makespan < b.makespan; };
+    std::stable_sort(population.begin(), population.end(), byMakespan);
+
+    auto tournament = [&]() -> const Individual& {
+        int best = static_cast<int>(rng() % populationSize);
+        for (int k = 1; k < options.tournamentSize; ++k) {
+            int other = static_cast<int>(rng() % populationSize);
+            if (population[other].makespan < population[best].makespan) best = other;
+        }
+        return population[best];
+    };
+
+    const int eliteCount = std::min(std::max(0, options.eliteCount), populationSize - 1);
+    const int childCount = populationSize - eliteCount;
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    std::vector<char> selected(ci.numJobs());
+
+    // Memetik mod: işçi başına bir yerel arama; alt sınırı ve geçici alanları
+    // nesiller boyunca tekrar kullanılır
+    std::vector<LocalSearch> searches;
+    if (options.memetic && options.memeticCount > 0) {
+        int workers = pool ? pool->size() : 1;
+        searches.reserve(workers);
+        for (int w = 0; w < workers; ++w) {
+            searches.emplace_back(instance_, result.lowerBound);
+            searches.back().setEvaluationCache(options.cache);
+        }
+    }
+
+    int generation = 0;
+    for (; generation < options.generations; ++generation) {
+        if (population[0].makespan <= std::max(options.targetMakespan, result.lowerBound)) {
+            break; // Hedefe veya alt sınıra (optimal) ulaşıldı
+        }
+        if (options.timeLimitSeconds > 0.0 && elapsed() >= options.timeLimitSeconds) {
+            break;
+        }
+
+        // Çocukların öncelikleri (rastgele üreteç sadece bu seri bölümde kullanılır)
+        priorities.assign(childCount, {});
+        for (int i = 0; i < childCount; ++i) {
+            const Individual& p1 = tournament();
+            const Individual& p2 = tournament();
+            bool cross = unit(rng) < options.crossoverRate;
+            bool mutate = unit(rng) < options.mutationRate;
+            if (cross) {
+                for (char& s : selected) s = static_cast<char>(rng() % 2);
+            }
+
+            if (options.crossover == GeneticCrossover::JOX) {
+                if (cross) {
+                    joxPriority(ci, p1.schedule, p2.schedule, selected, priorities[i]);
+                } else {
+                    joxPriority(ci, p1.schedule, p1.schedule, selected, priorities[i]);
+                }
+                if (mutate) mutatePriority(ci, p1.schedule, priorities[i], rng);
+            } else {
+                std::vector<int> child = cross ? poxCrossover(p1.chromosome, p2.chromosome, selected)
+                                               : p1.chromosome;
+                if (mutate) mutateChromosome(child, rng);
+                chromosomePriority(ci, child, priorities[i]);
+            }
+        }
+        offspring.assign(childCount, Individual());
+        evaluate(childCount);
+
+        // Memetik mod: en iyi çocukları yerel aramayla cilala ve kromozomlarını güncelle
+        if (options.memetic && options.memeticCount > 0) {
+            std::stable_sort(offspring.begin(), offspring.end(), byMakespan);
+            int polished = std::min(options.memeticCount, childCount);
+            parallelFor(polished, [&](int worker, int i) {
+                Individual& child = offspring[i];
+                auto [improved, makespan] = searches[worker].improveSchedule(child.schedule,
+                                                                             options.memeticIterations);
+                if (makespan >= 0 && makespan < child.makespan) {
+                    child.schedule = std::move(improved);
+                    child.makespan = makespan;
+                    child.chromosome = encode(child.schedule);
+                }
+            });
+        }
+
+        // Elitizm: en iyi eliteCount birey kalır, gerisi çocuklarla değişir
+        population.resize(eliteCount);
+        for (Individual& child : offspring) {
+            population.push_back(std::move(child));
+        }
+        std::stable_sort(population.begin(), population.end(), byMakespan);
+    }
+
+    result.best = population[0].schedule;
+    result.bestMakespan = population[0].makespan == INT_MAX ? -1 : population[0].makespan;
+    result.generations = generation;
+    result.wallSeconds = elapsed();
+    return result;
+}
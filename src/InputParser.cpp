@@ -18,86 +18,318 @@ static bool whitespaceOnly(const std::string& s) {
     return true;
 }
 
-ProblemInstance InputParser::parseFromJsonFile(const std::string& filePath) {
-    std::ifstream in(filePath);
-    require(in.good(), "Cannot open file: " + filePath);
+namespace {
 
-    json j;
-    in >> j;
+// --------------------
+// Streaming (SAX) builder
+// --------------------
+// Tokenizes the file without materializing a DOM. Root values are buffered
+// as compact records (op machines as ids of a local IdTable) and validated in
+// finish(), after the whole document has been read, in the same order and
+// with the same messages as the DOM walk this parser replaced:
+// - a repeated key keeps its last value (like nlohmann's DOM), at every level
+// - `machines` is checked before any job, wherever it appears in the file
+// - malformed JSON is reported before any validation error
+class InstanceBuilder {
+public:
+    explicit InstanceBuilder(ProblemInstance& inst) : inst_(inst) {}
 
-    require(j.is_object(), "root must be a JSON object");
-    require(j.contains("machines") && j["machines"].is_array(), "`machines` must be an array");
-    require(j.contains("jobs") && j["jobs"].is_array(), "`jobs` must be an array");
+    // Validates the buffered document and fills the instance
+    void finish() {
+        require(rootSeen_ && !rootInvalid_, "root must be a JSON object");
+        require(machinesField_ == Field::Array, "`machines` must be an array");
+        require(jobsField_ == Field::Array, "`jobs` must be an array");
 
-    ProblemInstance inst;
+        for (PendingMachine& machine : machines_) {
+            require(machine.isString, "each machine id must be a string");
+            addMachine(std::move(machine.id));
+        }
+        require(!inst_.machines.empty(), "machines list cannot be empty");
 
-    // --------------------
-    // Machines
-    // --------------------
-    std::unordered_set<std::string> machineSet;
+        for (const PendingJob& job : jobs_) {
+            addJob(job);
+        }
+        require(!inst_.jobs.empty(), "jobs list cannot be empty");
+    }
 
-    for (const auto& m : j["machines"]) {
-        require(m.is_string(), "each machine id must be a string");
-        std::string mid = m.get<std::string>();
+    // ---- nlohmann SAX interface ----
+    bool null() { return scalar(Value::Other); }
+    bool boolean(bool) { return scalar(Value::Other); }
+    bool number_float(json::number_float_t, const std::string&) { return scalar(Value::Other); }
+    bool binary(json::binary_t&) { return scalar(Value::Other); }
 
-        require(!mid.empty() && !whitespaceOnly(mid), "machine id cannot be empty/whitespace");
-        require(!machineSet.count(mid), "duplicate machine id: " + mid);
+    bool number_integer(json::number_integer_t v) {
+        integer_ = static_cast<long long>(v);
+        return scalar(Value::Integer);
+    }
 
-        machineSet.insert(mid);
-        inst.machines.emplace(mid, std::make_unique<Machine>(mid));
+    bool number_unsigned(json::number_unsigned_t v) {
+        integer_ = static_cast<long long>(v);
+        return scalar(Value::Integer);
     }
 
-    require(!inst.machines.empty(), "machines list cannot be empty");
+    bool string(json::string_t& v) {
+        string_ = std::move(v);
+        return scalar(Value::String);
+    }
 
-    // --------------------
-    // Jobs
-    // --------------------
-    std::unordered_set<std::string> jobSet;
+    bool key(json::string_t& k) {
+        if (skipDepth_ == 0) key_ = std::move(k);
+        return true;
+    }
 
-    for (const auto& job : j["jobs"]) {
-        require(job.is_object(), "each job must be an object");
-        require(job.contains("id") && job["id"].is_string(), "job missing string `id`");
+    bool start_object(std::size_t) {
+        if (skipDepth_ > 0) {
+            ++skipDepth_;
+            return true;
+        }
+        if (stack_.empty()) {
+            rootSeen_ = true;
+            stack_.push_back(Ctx::Root);
+            return true;
+        }
+        switch (stack_.back()) {
+            case Ctx::Jobs:
+                jobs_.emplace_back();
+                stack_.push_back(Ctx::Job);
+                return true;
+            case Ctx::Operations:
+                jobs_.back().ops.emplace_back();
+                stack_.push_back(Ctx::Op);
+                return true;
+            default:
+                nonScalar();
+                return true;
+        }
+    }
 
-        std::string jid = job["id"].get<std::string>();
-        require(!jid.empty() && !whitespaceOnly(jid), "job id cannot be empty/whitespace");
-        require(!jobSet.count(jid), "duplicate job id: " + jid);
+    bool end_object() {
+        if (skipDepth_ > 0) {
+            --skipDepth_;
+            return true;
+        }
+        stack_.pop_back();
+        return true;
+    }
+
+    bool start_array(std::size_t) {
+        if (skipDepth_ > 0) {
+            ++skipDepth_;
+            return true;
+        }
+        if (stack_.empty()) {
+            nonScalar();
+            return true;
+        }
+        Ctx ctx = stack_.back();
+        if (ctx == Ctx::Root && key_ == "machines") {
+            machinesField_ = Field::Array;
+            machines_.clear();
+            stack_.push_back(Ctx::Machines);
+        } else if (ctx == Ctx::Root && key_ == "jobs") {
+            jobsField_ = Field::Array;
+            jobs_.clear();
+            stack_.push_back(Ctx::Jobs);
+        } else if (ctx == Ctx::Job && key_ == "operations") {
+            jobs_.back().hasOps = true;
+            jobs_.back().ops.clear();
+            stack_.push_back(Ctx::Operations);
+        } else {
+            nonScalar();
+        }
+        return true;
+    }
+
+    bool end_array() {
+        if (skipDepth_ > 0) {
+            --skipDepth_;
+            return true;
+        }
+        stack_.pop_back();
+        return true;
+    }
+
+    // Rethrows nlohmann's own exception type, like `in >> j` would
+    template <class Exception>
+    bool parse_error(std::size_t, const std::string&, const Exception& ex) {
+        throw ex;
+    }
+
+private:
+    enum class Ctx { Root, Machines, Jobs, Job, Operations, Op };
+    enum class Value { String, Integer, Other, Container };
+    enum class Field { Missing, Array, Invalid };
+
+    struct PendingMachine {
+        bool isString = false;
+        std::string id;
+    };
+
+    struct PendingOp {
+        bool isObject = true;
+        bool hasMachine = false;
+        bool hasDuration = false;
+        int machine = -1;       // machineNames_ id
+        long long duration = 0;
+    };
 
-        jobSet.insert(jid);
+    struct PendingJob {
+        bool isObject = true;
+        bool hasId = false;
+        bool hasOps = false;
+        std::string id;
+        std::vector<PendingOp> ops;
+    };
 
-        require(job.contains("operations") && job["operations"].is_array(),
-                "job " + jid + " missing `operations` array");
+    ProblemInstance& inst_;
+    std::vector<Ctx> stack_;
+    int skipDepth_ = 0;
+    std::string key_;
+    std::string string_;
+    long long integer_ = 0;
 
-        const auto& opsJson = job["operations"];
-        require(!opsJson.empty(), "job " + jid + " operations cannot be empty");
+    bool rootSeen_ = false;
+    bool rootInvalid_ = false;
+    Field machinesField_ = Field::Missing;
+    Field jobsField_ = Field::Missing;
+    std::vector<PendingMachine> machines_;
+    std::vector<PendingJob> jobs_;
+    IdTable machineNames_;  // op machine strings, stored once each
+    std::unordered_set<std::string> machineSet_;
+    std::unordered_set<std::string> jobSet_;
+
+    // An object or array where the schema does not expect one: record it like
+    // a wrong-typed scalar, then ignore everything inside it
+    void nonScalar() {
+        scalar(Value::Container);
+        skipDepth_ = 1;
+    }
+
+    bool scalar(Value type) {
+        if (skipDepth_ > 0) {
+            return true;
+        }
+        if (stack_.empty()) {
+            rootInvalid_ = true;
+            return true;
+        }
+
+        switch (stack_.back()) {
+            case Ctx::Root:
+                if (key_ == "machines") {
+                    machinesField_ = Field::Invalid;
+                    machines_.clear();
+                } else if (key_ == "jobs") {
+                    jobsField_ = Field::Invalid;
+                    jobs_.clear();
+                }
+                break;
+
+            case Ctx::Machines:
+                machines_.push_back(PendingMachine{type == Value::String, std::move(string_)});
+                break;
+
+            case Ctx::Jobs:
+                jobs_.emplace_back();
+                jobs_.back().isObject = false;
+                break;
+
+            case Ctx::Job: {
+                PendingJob& job = jobs_.back();
+                if (key_ == "id") {
+                    job.hasId = type == Value::String;
+                    if (job.hasId) job.id = std::move(string_);
+                } else if (key_ == "operations") {
+                    job.hasOps = false;
+                    job.ops.clear();
+                }
+                break;
+            }
+
+            case Ctx::Operations:
+                jobs_.back().ops.emplace_back();
+                jobs_.back().ops.back().isObject = false;
+                break;
+
+            case Ctx::Op: {
+                PendingOp& op = jobs_.back().ops.back();
+                if (key_ == "machine") {
+                    op.hasMachine = type == Value::String;
+                    if (op.hasMachine) op.machine = machineNames_.intern(string_);
+                } else if (key_ == "duration") {
+                    op.hasDuration = type == Value::Integer;
+                    op.duration = integer_;
+                }
+                break;
+            }
+        }
+        return true;
+    }
+
+    void addMachine(std::string mid) {
+        require(!mid.empty() && !whitespaceOnly(mid), "machine id cannot be empty/whitespace");
+        require(!machineSet_.count(mid), "duplicate machine id: " + mid);
+
+        machineSet_.insert(mid);
+        inst_.machines.emplace(mid, std::make_unique<Machine>(mid));
+    }
+
+    void addJob(const PendingJob& job) {
+        require(job.isObject, "each job must be an object");
+        require(job.hasId, "job missing string `id`");
+
+        const std::string& jid = job.id;
+        require(!jid.empty() && !whitespaceOnly(jid), "job id cannot be empty/whitespace");
+        require(!jobSet_.count(jid), "duplicate job id: " + jid);
+
+        jobSet_.insert(jid);
+
+        require(job.hasOps, "job " + jid + " missing `operations` array");
+        require(!job.ops.empty(), "job " + jid + " operations cannot be empty");
 
         std::vector<Operation> ops;
-        ops.reserve(opsJson.size());
+        ops.reserve(job.ops.size());
 
-        for (size_t idx = 0; idx < opsJson.size(); ++idx) {
-            const auto& op = opsJson[idx];
-            require(op.is_object(), "job " + jid + " op " + std::to_string(idx) + " must be object");
+        for (size_t idx = 0; idx < job.ops.size(); ++idx) {
+            const PendingOp& op = job.ops[idx];
+            require(op.isObject, "job " + jid + " op " + std::to_string(idx) + " must be object");
 
-            require(op.contains("machine") && op["machine"].is_string(),
+            require(op.hasMachine,
                     "job " + jid + " op " + std::to_string(idx) + " missing string `machine`");
-            require(op.contains("duration") && op["duration"].is_number_integer(),
+            require(op.hasDuration,
                     "job " + jid + " op " + std::to_string(idx) + " missing int `duration`");
 
-            std::string mid = op["machine"].get<std::string>();
-            int dur = op["duration"].get<int>();
+            const std::string& mid = machineNames_.name(op.machine);
+            int dur = static_cast<int>(op.duration);
 
             require(!mid.empty() && !whitespaceOnly(mid),
                     "job " + jid + " op " + std::to_string(idx) + " machine cannot be empty/whitespace");
-            require(machineSet.count(mid),
+            require(machineSet_.count(mid),
                     "unknown machine " + mid + " in job " + jid + " op " + std::to_string(idx));
             require(dur > 0,
                     "duration must be > 0 in job " + jid + " op " + std::to_string(idx));
 
-            ops.emplace_back(jid, static_cast<int>(idx), mid, dur);
+            ops.emplace_back(static_cast<int>(idx), inst_.intern(mid), dur);
         }
 
-        inst.jobs.emplace(jid, std::make_unique<Job>(jid, std::move(ops)));
+        inst_.jobs.emplace(jid, std::make_unique<Job>(jid, std::move(ops)));
     }
+};
+
+} // namespace
+
+ProblemInstance InputParser::parseFromJsonFile(const std::string& filePath) {
+    std::ifstream in(filePath, std::ios::binary);
+    require(in.good(), "Cannot open file: " + filePath);
+
+    ProblemInstance inst;
+    InstanceBuilder builder(inst);
+
+    // Non-strict like `in >> j`: trailing content after the root value is ignored
+    json::sax_parse(in, &builder, json::input_format_t::json, false);
+    builder.finish();
 
-    require(!inst.jobs.empty(), "jobs list cannot be empty");
+    // Dense view is built once here so solvers never hash ids in hot loops
+    inst.compile();
     return inst;
 }
@@ -3,97 +3,210 @@
 #include <climits>
 
 LocalSearch::LocalSearch(const ProblemInstance& instance)
-    : instance_(instance) {
+    : LocalSearch(instance, LowerBounds::best(instance)) {
 }
 
-Schedule LocalSearch::swapAdjacentOperations(
-    const Schedule& schedule,
-    const std::string& machineId,
-    size_t pos1,
-    size_t pos2) const {
-    
-    Schedule newSchedule = schedule;
+LocalSearch::LocalSearch(const ProblemInstance& instance, int lowerBound)
+    : instance_(instance), lowerBound_(lowerBound) {
+}
+
+void LocalSearch::setEvaluationMode(EvaluationMode mode, int verifiedCandidates) {
+    evaluationMode_ = mode;
+    verifiedCandidates_ = std::max(1, verifiedCandidates);
+}
+
+void LocalSearch::setThreadCount(int threads) {
+    // Havuz oluşturulmadan önce yoğun görünüm hazır olmalı (tembel derleme thread-safe değil)
+    instance_.compiled();
     
-    // Makine sırasını kontrol et
-    auto it = newSchedule.machineOrder.find(machineId);
-    if (it == newSchedule.machineOrder.end()) {
-        return newSchedule; // Makine bulunamadı
+    if (threads == 1) {
+        pool_.reset();
+    } else {
+        pool_ = std::make_shared<ThreadPool>(threads);
     }
+    workers_.clear();
+}
+
+void LocalSearch::setIterationCallback(std::function<bool(int iteration, int makespan)> callback) {
+    iterationCallback_ = std::move(callback);
+}
+
+int LocalSearch::estimateSwapMakespan(
+    const Schedule& schedule,
+    const std::vector<int>& tails,
+    int seqIndex) const {
     
-    std::vector<OpKey>& sequence = it->second;
+    const CompiledInstance& ci = instance_.compiled();
+    const std::vector<int>& dur = ci.opDuration;
+    int m = ci.opMachine[schedule.sequence[seqIndex]];
     
-    // Pozisyonları kontrol et
-    if (pos2 != pos1 + 1 || pos2 >= sequence.size()) {
-        return newSchedule; // Geçersiz pozisyonlar
-    }
+    // Swap'tan önce: ... -> prev -> u -> v -> next -> ...  Sonra: prev -> v -> u -> next
+    int u = schedule.sequence[seqIndex];
+    int v = schedule.sequence[seqIndex + 1];
+    int prev = seqIndex > schedule.machineBegin(m) ? schedule.sequence[seqIndex - 1] : -1;
+    int next = seqIndex + 2 < schedule.machineEnd(m) ? schedule.sequence[seqIndex + 2] : -1;
     
-    // İki işlem farklı işlerden olmalı
-    if (sequence[pos1].jobId == sequence[pos2].jobId) {
-        return newSchedule; // Aynı işten, swap yapılamaz
-    }
+    // İş öncülünün bitişi / iş ardılının süre + kuyruğu (yoksa 0)
+    auto jobPredEnd = [&](int op) {
+        return ci.opIndexOf(op) > 0 ? schedule.endTime[op - 1] : 0;
+    };
+    auto jobSuccTail = [&](int op) {
+        int succ = op + 1;
+        if (succ < ci.numOps() && ci.opJob[succ] == ci.opJob[op] && schedule.position[succ] >= 0) {
+            return dur[succ] + tails[succ];
+        }
+        return 0;
+    };
     
-    // Swap yap
-    std::swap(sequence[pos1], sequence[pos2]);
+    // Yeni başlar: v önce, u sonra
+    int headV = std::max(jobPredEnd(v), prev >= 0 ? schedule.endTime[prev] : 0);
+    int headU = std::max(jobPredEnd(u), headV + dur[v]);
     
-    // opTimes'ı temizle, yeniden çözülecek
-    newSchedule.opTimes.clear();
+    // Yeni kuyruklar: u sonda, v önünde
+    int tailU = std::max(jobSuccTail(u), next >= 0 ? dur[next] + tails[next] : 0);
+    int tailV = std::max(jobSuccTail(v), dur[u] + tailU);
     
-    return newSchedule;
+    return std::max(headV + dur[v] + tailV, headU + dur[u] + tailU);
 }
 
-std::pair<int, Schedule> LocalSearch::findBestSwap(
-    const Schedule& currentSchedule,
-    int currentMakespan) const {
-    
-    int bestMakespan = currentMakespan;
-    Schedule bestSchedule = currentSchedule;
-    bool improved = false;
-    
-    // Her makine için bitişik işlemleri kontrol et
-    for (const auto& [machineId, sequence] : currentSchedule.machineOrder) {
-        if (sequence.size() < 2) {
-            continue; // En az 2 işlem gerekli
-        }
-        
-        // Her bitişik çifti dene
-        for (size_t i = 0; i < sequence.size() - 1; ++i) {
-            // Farklı işlerden olmalı
-            if (sequence[i].jobId == sequence[i + 1].jobId) {
-                continue;
+std::pair<int, SwapMove> LocalSearch::evaluateCandidates(
+    Schedule& working,
+    int currentMakespan,
+    const std::vector<int>& candidates,
+    std::uint64_t hash) const {
+    
+    // (makespan, aday indeksi) çiftlerinin sözlüksel minimumu: eşitlikte küçük indeks
+    struct Best {
+        int makespan;
+        int index;
+    };
+    
+    // [begin, end) aralığındaki adayları verilen çizelgede uygula/geri al
+    auto scan = [&](Schedule& schedule, MoveJournal& journal, int begin, int end) {
+        Best best{currentMakespan, -1};
+        for (int c = begin; c < end; ++c) {
+            SwapMove move(candidates[c]);
+            int candidateMakespan = -1;
+            std::uint64_t candidateHash = 0;
+            if (cache_) {
+                candidateHash = move.hashAfter(schedule, hash);
+                if (cache_->lookup(candidateHash, candidateMakespan)) {
+                    if (candidateMakespan >= 0 && candidateMakespan < best.makespan) {
+                        best = Best{candidateMakespan, c};
+                    }
+                    continue; // Daha önce değerlendirildi: çözme gerekmez
+                }
             }
             
-            // Swap yap
-            Schedule candidate = swapAdjacentOperations(currentSchedule, machineId, i, i + 1);
-            
-            // Çizelgeyi çöz
-            if (!ScheduleDecoder::decode(candidate, instance_)) {
-                continue; // Çözülemedi
+            if (!move.apply(schedule, instance_, journal)) {
+                if (cache_) cache_->insert(candidateHash, -1);
+                continue; // Döngü: uygulanamaz
             }
+            candidateMakespan = MakespanCalculator::calculate(schedule);
+            move.undo(schedule, journal);
+            if (cache_) cache_->insert(candidateHash, candidateMakespan);
             
-            // Uygulanabilirliği kontrol et
-            if (!FeasibilityChecker::isValid(candidate, instance_)) {
-                continue; // Geçersiz
+            if (candidateMakespan < best.makespan) {
+                best = Best{candidateMakespan, c};
             }
-            
-            // Makespan'ı hesapla
-            int candidateMakespan = MakespanCalculator::calculate(candidate);
-            
-            // Daha iyi mi?
-            if (candidateMakespan < bestMakespan) {
-                bestMakespan = candidateMakespan;
-                bestSchedule = candidate;
-                improved = true;
+        }
+        return best;
+    };
+    
+    Best best{currentMakespan, -1};
+    int n = static_cast<int>(candidates.size());
+    
+    if (!pool_ || n < 2 * pool_->size()) {
+        // Seri değerlendirme (tek bir çalışma çizelgesi)
+        best = scan(working, scratch_.journal, 0, n);
+    } else {
+        // Her işçi kendi kopyasında çalışır; working paralel bölgede sadece okunur
+        workers_.resize(pool_->size());
+        for (WorkerScratch& ws : workers_) {
+            ws.bestIndex = -1;
+        }
+        
+        pool_->parallelFor(n, [&](int worker, int begin, int end) {
+            WorkerScratch& ws = workers_[worker];
+            ws.working = working; // Kapasite tekrar kullanılır: memcpy
+            Best partial = scan(ws.working, ws.journal, begin, end);
+            ws.bestMakespan = partial.makespan;
+            ws.bestIndex = partial.index;
+        });
+        
+        // Deterministik indirgeme: parçalar aday sırasında, eşitlikte önceki kazanır
+        for (const WorkerScratch& ws : workers_) {
+            if (ws.bestIndex >= 0 && (ws.bestMakespan < best.makespan ||
+                                      (ws.bestMakespan == best.makespan && ws.bestIndex < best.index))) {
+                best = Best{ws.bestMakespan, ws.bestIndex};
             }
         }
     }
     
-    return {bestMakespan, bestSchedule};
+    if (best.index < 0) {
+        return {currentMakespan, SwapMove()};
+    }
+    return {best.makespan, SwapMove(candidates[best.index])};
+}
+
+std::pair<int, SwapMove> LocalSearch::findBestSwap(
+    Schedule& working,
+    int currentMakespan,
+    std::uint64_t hash) const {
+    
+    const CompiledInstance& ci = instance_.compiled();
+    std::vector<int>& candidates = scratch_.candidates;
+    candidates.clear();
+    
+    // Sadece kritik bloklardaki bitişik çiftler makespan'ı azaltabilir:
+    // kritik yolda ters çevrilmeyen her swap sonrası bu yol aynen kalır
+    std::vector<CriticalBlock>& blocks = scratch_.blocks;
+    CriticalPathAnalyzer::tracePath(working, instance_, scratch_.path, blocks);
+    
+    std::vector<int>& criticalPairs = scratch_.criticalPairs;
+    criticalPairs.clear();
+    for (const CriticalBlock& block : blocks) {
+        for (int a = block.begin; a < block.end; ++a) {
+            // Farklı işlerden olmalı
+            if (ci.opJob[working.sequence[a]] != ci.opJob[working.sequence[a + 1]]) {
+                criticalPairs.push_back(a);
+            }
+        }
+    }
+    
+    if (evaluationMode_ == EvaluationMode::HeadTailEstimate) {
+        // Baş/kuyruk değerleri ile tüm adayları çözmeden puanla
+        std::vector<int>& tails = scratch_.tails;
+        ScheduleDecoder::computeTails(working, instance_, tails);
+        
+        // (tahmin, sequence indeksi): sadece iyileştirebilecek adaylar
+        std::vector<std::pair<int, int>>& estimates = scratch_.estimates;
+        estimates.clear();
+        for (int a : criticalPairs) {
+            int estimate = estimateSwapMakespan(working, tails, a);
+            if (estimate < currentMakespan) {
+                estimates.emplace_back(estimate, a);
+            }
+        }
+        
+        // En umut verici k adayı tam olarak çöz ve doğrula
+        size_t k = std::min(estimates.size(), static_cast<size_t>(verifiedCandidates_));
+        std::partial_sort(estimates.begin(), estimates.begin() + k, estimates.end());
+        for (size_t c = 0; c < k; ++c) {
+            candidates.push_back(estimates[c].second);
+        }
+    } else {
+        candidates.swap(criticalPairs);
+    }
+    
+    return evaluateCandidates(working, currentMakespan, candidates, hash);
 }
 
 std::pair<Schedule, int> LocalSearch::improveSchedule(
     const Schedule& initialSchedule,
     int maxIterations) const {
     
+    // Tek çalışma çizelgesi: adaylar yerinde uygulanıp geri alınır
     Schedule currentSchedule = initialSchedule;
     
     // İlk çizelgeyi çöz
@@ -103,22 +216,51 @@ std::pair<Schedule, int> LocalSearch::improveSchedule(
     
     // İlk makespan'ı hesapla
     int currentMakespan = MakespanCalculator::calculate(currentSchedule);
+    MoveJournal& journal = scratch_.journal;
+    
+    // Önbellek varsa güncel sıranın özeti hamlelerle birlikte O(1) güncellenir
+    std::uint64_t hash = 0;
+    if (cache_) {
+        hash = ScheduleHash::compute(currentSchedule);
+        cache_->insert(hash, currentMakespan);
+    }
     
     // Yerel arama döngüsü
     for (int iteration = 0; iteration < maxIterations; ++iteration) {
+        if (currentMakespan <= lowerBound_) {
+            break; // Alt sınıra ulaşıldı: optimal
+        }
+        
         // En iyi swap'ı bul
-        auto [newMakespan, newSchedule] = findBestSwap(currentSchedule, currentMakespan);
+        auto [newMakespan, bestMove] = findBestSwap(currentSchedule, currentMakespan, hash);
         
         // İyileştirme var mı?
-        if (newMakespan >= currentMakespan) {
+        if (!bestMove.isValid() || newMakespan >= currentMakespan) {
             break; // Daha iyi çözüm bulunamadı
         }
         
-        // Yeni çözümü kabul et
-        currentSchedule = newSchedule;
-        currentMakespan = newMakespan;
+        // En iyi hamleyi kalıcı olarak uygula. Önbellekten gelen değer burada
+        // doğrulanır: özet çakışmasında kayıt düzeltilir, hamle geri alınır ve
+        // adaylar yeniden değerlendirilir (kötü bir hamle asla kabul edilmez)
+        std::uint64_t nextHash = cache_ ? bestMove.hashAfter(currentSchedule, hash) : 0;
+        if (!bestMove.apply(currentSchedule, instance_, journal)) {
+            if (cache_) cache_->insert(nextHash, -1);
+            continue;
+        }
+        int appliedMakespan = MakespanCalculator::calculate(currentSchedule);
+        if (cache_ && appliedMakespan != newMakespan) {
+            cache_->insert(nextHash, appliedMakespan);
+            bestMove.undo(currentSchedule, journal);
+            continue;
+        }
+        hash = nextHash;
+        currentMakespan = appliedMakespan;
+        
+        // Dış denetleyici aramayı durdurmak isteyebilir
+        if (iterationCallback_ && !iterationCallback_(iteration + 1, currentMakespan)) {
+            break;
+        }
     }
     
-    return {currentSchedule, currentMakespan};
+    return {std::move(currentSchedule), currentMakespan};
 }
-
@@ -0,0 +1,85 @@
+#include "LowerBounds.h"
+#include <algorithm>
+#include <climits>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Kesintili tek makine problemi 1|r_j, pmtn|max(C_j + q_j): her an, serbest
+// bırakılmış işlemlerden kuyruğu en büyük olan çalışır (Jackson). ops, serbest
+// bırakma zamanına göre sıralıdır.
+int jacksonPreemptive(const std::vector<int>& ops, const std::vector<int>& head,
+                      const std::vector<int>& tail, const std::vector<int>& duration) {
+    std::priority_queue<std::pair<int, int>> available; // (kuyruk, kalan süre)
+    size_t next = 0;
+    long long t = 0;
+    long long bound = 0;
+    while (next < ops.size() || !available.empty()) {
+        if (available.empty()) {
+            t = std::max<long long>(t, head[ops[next]]);
+        }
+        while (next < ops.size() && head[ops[next]] <= t) {
+            int op = ops[next++];
+            available.emplace(tail[op], duration[op]);
+        }
+
+        auto [q, remaining] = available.top();
+        available.pop();
+        // Sonraki serbest bırakmaya kadar çalış (orada daha büyük kuyruklu bir işlem gelebilir)
+        long long release = next < ops.size() ? head[ops[next]] : LLONG_MAX;
+        long long run = std::min<long long>(remaining, release - t);
+        t += run;
+        remaining -= static_cast<int>(run);
+        if (remaining == 0) {
+            bound = std::max(bound, t + q);
+        } else {
+            available.emplace(q, remaining);
+        }
+    }
+    return static_cast<int>(bound);
+}
+
+} // namespace
+
+LowerBoundReport LowerBounds::compute(const ProblemInstance& instance) {
+    const CompiledInstance& ci = instance.compiled();
+    LowerBoundReport report;
+
+    for (int j = 0; j < ci.numJobs(); ++j) {
+        report.jobLength = std::max(report.jobLength, ci.jobTotalTime[j]);
+    }
+
+    // Başlar: iş öncüllerinin toplam süresi; kuyruklar: iş ardıllarının toplam süresi
+    std::vector<int> head(ci.numOps(), 0);
+    std::vector<int> tail(ci.numOps(), 0);
+    std::vector<int> load(ci.numMachines(), 0);
+    std::vector<std::vector<int>> machineOps(ci.numMachines());
+    for (int m = 0; m < ci.numMachines(); ++m) {
+        machineOps[m].reserve(ci.machineOpCount[m]);
+    }
+    for (int op = 0; op < ci.numOps(); ++op) {
+        if (ci.opIndexOf(op) > 0) {
+            head[op] = head[op - 1] + ci.opDuration[op - 1];
+        }
+        tail[op] = ci.remainingWork[op] - ci.opDuration[op];
+        load[ci.opMachine[op]] += ci.opDuration[op];
+        machineOps[ci.opMachine[op]].push_back(op);
+    }
+
+    for (int m = 0; m < ci.numMachines(); ++m) {
+        report.machineLoad = std::max(report.machineLoad, load[m]);
+
+        std::vector<int>& ops = machineOps[m];
+        std::sort(ops.begin(), ops.end(), [&](int a, int b) {
+            return head[a] != head[b] ? head[a] < head[b] : a < b;
+        });
+        int bound = jacksonPreemptive(ops, head, tail, ci.opDuration);
+        if (bound > report.oneMachine) {
+            report.oneMachine = bound;
+            report.oneMachineMachine = m;
+        }
+    }
+    return report;
+}
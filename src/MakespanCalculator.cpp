@@ -1,17 +1,22 @@
 #include "MakespanCalculator.h"
 
 int MakespanCalculator::calculate(const Schedule& schedule) {
+    return schedule.makespan;
+}
+
+int MakespanCalculator::recalculate(Schedule& schedule) {
     int makespan = -1;
+    int makespanOp = -1;
 
     // Tüm işlemler arasında maksimum bitiş zamanını bul
-    for (const auto& [jobId, opTimes] : schedule.opTimes) {
-        for (const auto& [opIndex, timeWindow] : opTimes) {
-            if (timeWindow.end > makespan) {
-                makespan = timeWindow.end;
-            }
+    for (size_t op = 0; op < schedule.endTime.size(); ++op) {
+        if (schedule.endTime[op] > makespan) {
+            makespan = schedule.endTime[op];
+            makespanOp = static_cast<int>(op);
         }
     }
 
+    schedule.makespan = makespan;
+    schedule.makespanOp = makespanOp;
     return makespan;
 }
-
@@ -0,0 +1,45 @@
+#include "Move.h"
+
+bool SwapMove::apply(Schedule& schedule, const ProblemInstance& instance,
+                     MoveJournal& journal) const {
+    journal.clear();
+    journal.makespan = schedule.makespan;
+    journal.makespanOp = schedule.makespanOp;
+
+    return ScheduleDecoder::redecodeAdjacentSwap(schedule, instance, seqIndex, &journal.changes) ==
+           ScheduleDecoder::Status::Ok;
+}
+
+namespace {
+
+// Zamanları ters sırada geri yükle (bir işlem birden fazla kez değişmiş olabilir)
+void restoreTimes(Schedule& schedule, const MoveJournal& journal) {
+    for (auto it = journal.changes.rbegin(); it != journal.changes.rend(); ++it) {
+        schedule.startTime[it->op] = it->start;
+        schedule.endTime[it->op] = it->end;
+    }
+    schedule.makespan = journal.makespan;
+    schedule.makespanOp = journal.makespanOp;
+}
+
+} // namespace
+
+void SwapMove::undo(Schedule& schedule, const MoveJournal& journal) const {
+    schedule.swapPositions(seqIndex, seqIndex + 1);
+    restoreTimes(schedule, journal);
+}
+
+bool InsertMove::apply(Schedule& schedule, const ProblemInstance& instance,
+                       MoveJournal& journal) const {
+    journal.clear();
+    journal.makespan = schedule.makespan;
+    journal.makespanOp = schedule.makespanOp;
+
+    return ScheduleDecoder::redecodeInsertion(schedule, instance, from, to, &journal.changes) ==
+           ScheduleDecoder::Status::Ok;
+}
+
+void InsertMove::undo(Schedule& schedule, const MoveJournal& journal) const {
+    schedule.moveOperation(to, from);
+    restoreTimes(schedule, journal);
+}
@@ -0,0 +1,102 @@
+#include "PortfolioSolver.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+
+PortfolioSolver::PortfolioSolver(const ProblemInstance& instance)
+    : instance_(instance) {
+}
+
+PortfolioResult PortfolioSolver::solve(const PortfolioOptions& options) const {
+    // İş parçacıkları başlamadan yoğun görünümü hazırla
+    instance_.compiled();
+
+    const std::vector<DispatchHeuristics::Rule>& rules =
+        options.rules.empty() ? DispatchHeuristics::allRules() : options.rules;
+    const int n = static_cast<int>(rules.size());
+
+    std::vector<StrategyResult> results(n);
+    std::vector<Schedule> schedules(n);
+    std::atomic<int> globalBest{INT_MAX};
+    std::atomic<int> nextStrategy{0};
+    const int lowerBound = LowerBounds::best(instance_);
+
+    // Atomik minimum güncellemesi
+    auto offerBest = [&](int makespan) {
+        int current = globalBest.load(std::memory_order_relaxed);
+        while (makespan >= 0 && makespan < current &&
+               !globalBest.compare_exchange_weak(current, makespan, std::memory_order_relaxed)) {
+        }
+    };
+
+    auto runStrategy = [&](int index) {
+        auto started = std::chrono::steady_clock::now();
+        StrategyResult& result = results[index];
+        result.name = DispatchHeuristics::ruleName(rules[index]);
+
+        // Dağıtım kuralı ile başlangıç çizelgesi
+        DispatchHeuristics heuristics(instance_);
+        Schedule initial = heuristics.buildSchedule(rules[index]);
+        result.initialMakespan = MakespanCalculator::calculate(initial);
+        offerBest(result.initialMakespan);
+
+        // Yerel arama; ortak en iyiden çok gerideyse kesilir
+        LocalSearch search(instance_);
+        search.setIterationCallback([&](int iteration, int makespan) {
+            result.iterations = iteration;
+            offerBest(makespan);
+            int best = globalBest.load(std::memory_order_relaxed);
+            if (best <= lowerBound) {
+                // Başka bir strateji optimale ulaştı
+                result.cutOff = makespan > best;
+                return false;
+            }
+            if (iteration < options.cutoffGraceIterations) {
+                return true;
+            }
+            if (makespan > best * (1.0 + options.cutoffRatio)) {
+                result.cutOff = true;
+                return false;
+            }
+            return true;
+        });
+
+        auto [improved, makespan] = search.improveSchedule(initial, options.maxIterations);
+        result.makespan = makespan;
+        offerBest(makespan);
+        schedules[index] = std::move(improved);
+
+        result.wallSeconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - started).count();
+    };
+
+    // Stratejiler işçiler arasında dinamik olarak dağıtılır
+    ThreadPool pool(std::min(options.threads > 0 ? options.threads
+                                                 : static_cast<int>(std::thread::hardware_concurrency()),
+                             std::max(1, n)));
+    pool.run([&](int) {
+        for (int index = nextStrategy.fetch_add(1); index < n; index = nextStrategy.fetch_add(1)) {
+            runStrategy(index);
+        }
+    });
+
+    // En iyi strateji (eşitlikte kural sırasında önce gelen)
+    PortfolioResult out;
+    out.lowerBound = lowerBound;
+    int bestIndex = -1;
+    for (int i = 0; i < n; ++i) {
+        if (results[i].makespan >= 0 &&
+            (bestIndex < 0 || results[i].makespan < results[bestIndex].makespan)) {
+            bestIndex = i;
+        }
+    }
+    if (bestIndex >= 0) {
+        out.best = std::move(schedules[bestIndex]);
+        out.bestMakespan = results[bestIndex].makespan;
+        out.bestStrategy = results[bestIndex].name;
+    }
+    out.strategies = std::move(results);
+    return out;
+}
@@ -1,114 +1,442 @@
 #include "ScheduleDecoder.h"
 #include <algorithm>
 #include <stdexcept>
-#include <unordered_set>
+#include <vector>
+
+namespace {
+
+// Artımlı çözme için iş parçacığı başına tekrar kullanılan geçici alan
+thread_local DecoderWorkspace scratch;
+
+} // namespace
+
+DecoderWorkspace& ScheduleDecoder::threadWorkspace() {
+    return scratch;
+}
 
 bool ScheduleDecoder::decode(Schedule& schedule, const ProblemInstance& instance) {
-    // Mevcut opTimes'ı temizle
-    schedule.opTimes.clear();
-
-    // Her işin bir sonraki işleminin ne zaman başlayabileceğini takip et (iş hazır zamanı)
-    std::unordered_map<std::string, int> jobReadyTime;
-    
-    // Her makinenin ne zaman müsait olduğunu ve sıradaki konumunu takip et
-    std::unordered_map<std::string, int> machineAvailableTime;
-    std::unordered_map<std::string, size_t> machinePosition;
-
-    // Makine müsait zamanlarını ve konumlarını başlat
-    for (const auto& [machineId, _] : schedule.machineOrder) {
-        machineAvailableTime[machineId] = 0;
-        machinePosition[machineId] = 0;
-    }
-
-    // Hangi işlemlerin çizelgelendiğini takip et
-    std::unordered_map<std::string, std::unordered_set<int>> scheduledOps;
-
-    // Tüm işlemler çizelgelenene veya takılı kalana kadar çizelgeleme yap
-    bool progress = true;
-    int maxIterations = 10000; // Güvenlik sınırı
-    int iterations = 0;
-
-    while (progress && iterations < maxIterations) {
-        progress = false;
-        iterations++;
-
-        // Her makinede işlemleri çizelgelemeyi dene
-        for (auto& [machineId, opSequence] : schedule.machineOrder) {
-            size_t& pos = machinePosition[machineId];
-            if (pos >= opSequence.size()) {
-                continue; // Bu makinenin sırası bitti
-            }
+    return decodeWithStatus(schedule, instance, scratch) == Status::Ok;
+}
 
-            const OpKey& opKey = opSequence[pos];
-
-            // Bu işlemin çizelgelenip çizelgenemeyeceğini kontrol et (aynı işin önceki işlemi bitmiş olmalı)
-            bool canSchedule = true;
-            int jobReady = 0;
-
-            if (opKey.opIndex > 0) {
-                // Aynı işin önceki işleminin çizelgelenip çizelgenmediğini kontrol et
-                auto scheduledIt = scheduledOps.find(opKey.jobId);
-                if (scheduledIt == scheduledOps.end() || 
-                    scheduledIt->second.find(opKey.opIndex - 1) == scheduledIt->second.end()) {
-                    canSchedule = false; // Önceki işlem henüz çizelgelenmedi
-                } else {
-                    // Önceki işlemin bitiş zamanını al
-                    auto jobIt = schedule.opTimes.find(opKey.jobId);
-                    if (jobIt != schedule.opTimes.end()) {
-                        auto prevIt = jobIt->second.find(opKey.opIndex - 1);
-                        if (prevIt != jobIt->second.end()) {
-                            jobReady = prevIt->second.end;
-                        }
-                    }
-                }
-            }
+ScheduleDecoder::Status ScheduleDecoder::decodeWithStatus(
+    Schedule& schedule, const ProblemInstance& instance) {
+    return decodeWithStatus(schedule, instance, scratch);
+}
 
-            if (!canSchedule) {
-                continue; // Bu işlemi şimdilik atla
-            }
+ScheduleDecoder::Status ScheduleDecoder::decodeWithStatus(
+    Schedule& schedule, const ProblemInstance& instance, DecoderWorkspace& workspace) {
+    const CompiledInstance& ci = instance.compiled();
+    const int numOps = ci.numOps();
+
+    // Çizelge bu örneğin yoğun düzeniyle kurulmuş olmalı
+    if (schedule.layout != &ci ||
+        schedule.numMachines() != ci.numMachines() ||
+        static_cast<int>(schedule.position.size()) != numOps) {
+        return Status::InvalidOperation;
+    }
+
+    // Mevcut zamanları temizle
+    schedule.startTime.assign(numOps, -1);
+    schedule.endTime.assign(numOps, -1);
+    schedule.makespan = -1;
+    schedule.makespanOp = -1;
+
+    std::vector<int>& inDegree = workspace.degree;
+    inDegree.assign(numOps, 0);
+    int presentCount = static_cast<int>(schedule.sequence.size());
 
-            // İşi ve işlemi al
-            const Job* job = instance.getJob(opKey.jobId);
-            if (!job) {
-                return false; // Geçersiz iş referansı
+    // Makine kenarları: her sıradaki işlem doğru makinede ve tek kez olmalı
+    for (int m = 0; m < ci.numMachines(); ++m) {
+        for (int p = schedule.machineBegin(m); p < schedule.machineEnd(m); ++p) {
+            int op = schedule.sequence[p];
+            if (ci.opMachine[op] != m) {
+                return Status::WrongMachine; // İşlem yanlış makineye atanmış
             }
+            if (schedule.position[op] != p) {
+                return Status::DuplicateOperation;
+            }
+            if (p > schedule.machineBegin(m)) {
+                inDegree[op]++;
+            }
+        }
+    }
+
+    // İş kenarları: aynı işin önceki işlemi de sıralarda olmalı
+    for (int op = 0; op < numOps; ++op) {
+        if (schedule.position[op] < 0 || ci.opIndexOf(op) == 0) {
+            continue;
+        }
+        if (schedule.position[op - 1] < 0) {
+            return Status::MissingPredecessor;
+        }
+        inDegree[op]++;
+    }
 
-            const std::vector<Operation>& ops = job->operations();
-            if (opKey.opIndex < 0 || opKey.opIndex >= static_cast<int>(ops.size())) {
-                return false; // Geçersiz işlem indeksi
+    // Giriş derecesi sıfır olan işlemlerden başlayarak topolojik geçiş
+    std::vector<int>& ready = workspace.ready;
+    ready.clear();
+    ready.reserve(numOps);
+    for (int op : schedule.sequence) {
+        if (inDegree[op] == 0) {
+            ready.push_back(op);
+        }
+    }
+
+    // startTime, öncüllerin en geç bitişini biriktirir: max(iş_hazır, makine_müsait)
+    std::vector<int>& start = schedule.startTime;
+    std::vector<int>& end = schedule.endTime;
+    for (int op : schedule.sequence) {
+        start[op] = 0;
+    }
+    int processed = 0;
+
+    while (!ready.empty()) {
+        int op = ready.back();
+        ready.pop_back();
+        processed++;
+
+        end[op] = start[op] + ci.opDuration[op];
+        if (end[op] > schedule.makespan) {
+            schedule.makespan = end[op];
+            schedule.makespanOp = op;
+        }
+
+        // Ardılların hazır zamanını güncelle ve giriş derecesini azalt
+        int jobSucc = op + 1;
+        if (jobSucc < numOps && ci.opJob[jobSucc] == ci.opJob[op] &&
+            schedule.position[jobSucc] >= 0) {
+            start[jobSucc] = std::max(start[jobSucc], end[op]);
+            if (--inDegree[jobSucc] == 0) ready.push_back(jobSucc);
+        }
+        int pos = schedule.position[op];
+        if (pos + 1 < schedule.machineEnd(ci.opMachine[op])) {
+            int mSucc = schedule.sequence[pos + 1];
+            start[mSucc] = std::max(start[mSucc], end[op]);
+            if (--inDegree[mSucc] == 0) ready.push_back(mSucc);
+        }
+    }
+
+    // İşlenmemiş işlem kaldıysa makine sıraları bir döngü oluşturuyor
+    if (processed < presentCount) {
+        schedule.makespan = -1;
+        schedule.makespanOp = -1;
+        return Status::Cycle;
+    }
+
+    return Status::Ok;
+}
+
+namespace {
+
+inline int jobSuccessor(const CompiledInstance& ci, const Schedule& s, int op) {
+    int next = op + 1;
+    if (next < ci.numOps() && ci.opJob[next] == ci.opJob[op] && s.position[next] >= 0) {
+        return next;
+    }
+    return -1;
+}
+
+inline int machineSuccessor(const CompiledInstance& ci, const Schedule& s, int op) {
+    int pos = s.position[op] + 1;
+    return pos < s.machineEnd(ci.opMachine[op]) ? s.sequence[pos] : -1;
+}
+
+inline int earliestStart(const CompiledInstance& ci, const Schedule& s, int op) {
+    int start = 0;
+    if (ci.opIndexOf(op) > 0) {
+        start = s.endTime[op - 1];
+    }
+    int pos = s.position[op];
+    if (pos > s.machineBegin(ci.opMachine[op])) {
+        start = std::max(start, s.endTime[s.sequence[pos - 1]]);
+    }
+    return start;
+}
+
+// u'dan v'ye doğrudan u->v kenarı dışında bir yol var mı? (eski grafikte)
+// Yol üzerindeki her x için end[x] <= start[v] olmalı; bu sınırla budanır.
+bool hasIndirectPath(const CompiledInstance& ci, const Schedule& s, int u, int v) {
+    int first = jobSuccessor(ci, s, u);
+    if (first < 0) {
+        return false;
+    }
+
+    const int limit = s.startTime[v];
+    scratch.stack.clear();
+    scratch.stack.push_back(first);
+    scratch.visitStamp[first] = scratch.stamp;
+
+    while (!scratch.stack.empty()) {
+        int x = scratch.stack.back();
+        scratch.stack.pop_back();
+        if (x == v) {
+            return true;
+        }
+        if (s.endTime[x] > limit) {
+            continue; // Buradan v'ye ulaşılamaz
+        }
+        for (int next : {jobSuccessor(ci, s, x), machineSuccessor(ci, s, x)}) {
+            if (next >= 0 && scratch.visitStamp[next] != scratch.stamp) {
+                scratch.visitStamp[next] = scratch.stamp;
+                scratch.stack.push_back(next);
             }
+        }
+    }
+    return false;
+}
+
+void pushQueued(const Schedule& s, int op) {
+    if (op < 0 || scratch.queuedStamp[op] == scratch.stamp) {
+        return;
+    }
+    scratch.queuedStamp[op] = scratch.stamp;
+    scratch.heap.emplace_back(-s.startTime[op], op);
+    std::push_heap(scratch.heap.begin(), scratch.heap.end());
+}
 
-            const Operation& op = ops[opKey.opIndex];
-            
-            // Bu işlemin bu makineye ait olduğunu doğrula
-            if (op.machineId() != machineId) {
-                return false; // İşlem yanlış makineye atanmış
+// v'den u'ya (ters yönde) öncüller üzerinden bir yol var mı? (eski grafikte)
+// Yol üzerindeki her x için start[x] >= end[u] olmalı; bu sınırla budanır.
+bool hasPathBackward(const CompiledInstance& ci, const Schedule& s, int from, int u) {
+    const int limit = s.endTime[u];
+    scratch.stack.clear();
+    scratch.stack.push_back(from);
+    scratch.visitStamp[from] = scratch.stamp;
+
+    while (!scratch.stack.empty()) {
+        int x = scratch.stack.back();
+        scratch.stack.pop_back();
+        if (x == u) {
+            return true;
+        }
+        if (s.startTime[x] < limit) {
+            continue; // Buradan u'ya ulaşılamaz
+        }
+        int jobPrev = ci.opIndexOf(x) > 0 ? x - 1 : -1;
+        int pos = s.position[x];
+        int machinePrev = pos > s.machineBegin(ci.opMachine[x]) ? s.sequence[pos - 1] : -1;
+        for (int prev : {jobPrev, machinePrev}) {
+            if (prev >= 0 && scratch.visitStamp[prev] != scratch.stamp) {
+                scratch.visitStamp[prev] = scratch.stamp;
+                scratch.stack.push_back(prev);
             }
+        }
+    }
+    return false;
+}
 
-            // Başlangıç zamanı = max(iş_hazır_zamanı, makine_müsait_zamanı)
-            int startTime = std::max(jobReady, machineAvailableTime[machineId]);
-            int endTime = startTime + op.duration();
+// Kuyruktaki işlemlerden başlayarak zamanları yayar ve makespan'ı günceller.
+// Yaklaşık topolojik sıra için eski başlangıç zamanına göre işlenir; bir işlem
+// daha sonra yeniden güncellenirse tekrar kuyruğa girer (DAG'de sonlanır).
+void propagateQueued(const CompiledInstance& ci, Schedule& schedule,
+                     std::vector<TimeChange>* trail) {
+    bool makespanOpShrank = false;
 
-            // Zaman penceresini kaydet
-            schedule.opTimes[opKey.jobId][opKey.opIndex] = TimeWindow{startTime, endTime};
-            scheduledOps[opKey.jobId].insert(opKey.opIndex);
+    while (!scratch.heap.empty()) {
+        std::pop_heap(scratch.heap.begin(), scratch.heap.end());
+        int op = scratch.heap.back().second;
+        scratch.heap.pop_back();
+        scratch.queuedStamp[op] = 0;
+
+        int start = earliestStart(ci, schedule, op);
+        if (start == schedule.startTime[op]) {
+            continue; // Zaman değişmedi: ardıllara yayılmaz
+        }
 
-            // Makine müsait zamanını güncelle
-            machineAvailableTime[machineId] = endTime;
+        if (trail) {
+            trail->push_back(TimeChange{op, schedule.startTime[op], schedule.endTime[op]});
+        }
+        schedule.startTime[op] = start;
+        schedule.endTime[op] = start + ci.opDuration[op];
 
-            // Bu makinedeki bir sonraki işleme geç
-            pos++;
-            progress = true;
+        if (schedule.endTime[op] > schedule.makespan) {
+            schedule.makespan = schedule.endTime[op];
+            schedule.makespanOp = op;
+        } else if (op == schedule.makespanOp && schedule.endTime[op] < schedule.makespan) {
+            makespanOpShrank = true;
         }
+
+        pushQueued(schedule, jobSuccessor(ci, schedule, op));
+        pushQueued(schedule, machineSuccessor(ci, schedule, op));
     }
 
-    // Tüm işlemlerin çizelgelenip çizelgenmediğini kontrol et
-    for (const auto& [machineId, opSequence] : schedule.machineOrder) {
-        if (machinePosition[machineId] < opSequence.size()) {
-            return false; // Tüm işlemler çizelgelenmedi (muhtemelen geçersiz öncelik nedeniyle)
+    // Makespan'ı belirleyen işlem erken bittiyse maksimumu yeniden bul
+    if (makespanOpShrank && schedule.endTime[schedule.makespanOp] < schedule.makespan) {
+        int makespan = -1;
+        int makespanOp = -1;
+        for (int op : schedule.sequence) {
+            if (schedule.endTime[op] > makespan) {
+                makespan = schedule.endTime[op];
+                makespanOp = op;
+            }
         }
+        schedule.makespan = makespan;
+        schedule.makespanOp = makespanOp;
+    }
+}
+
+} // namespace
+
+ScheduleDecoder::Status ScheduleDecoder::redecodeAdjacentSwap(
+    Schedule& schedule, const ProblemInstance& instance, int seqIndex,
+    std::vector<TimeChange>* trail) {
+    const CompiledInstance& ci = instance.compiled();
+
+    if (schedule.layout != &ci || schedule.makespan < 0 ||
+        seqIndex < 0 || seqIndex + 1 >= static_cast<int>(schedule.sequence.size())) {
+        return Status::InvalidOperation;
     }
 
-    return true;
+    int u = schedule.sequence[seqIndex];
+    int v = schedule.sequence[seqIndex + 1];
+    if (ci.opMachine[u] != ci.opMachine[v]) {
+        return Status::InvalidOperation; // Farklı makineler
+    }
+
+    scratch.prepare(ci.numOps());
+
+    // u ve v aynı işten ise v, u'ya iş kenarıyla da bağlıdır: swap döngü oluşturur
+    if (ci.opJob[u] == ci.opJob[v] || hasIndirectPath(ci, schedule, u, v)) {
+        return Status::Cycle;
+    }
+
+    schedule.swapPositions(seqIndex, seqIndex + 1);
+
+    // Başlangıç değişebilecek işlemler: v (yeni makine öncülü), u ve u'nun yeni ardılı
+    scratch.heap.clear();
+    pushQueued(schedule, v);
+    pushQueued(schedule, u);
+    pushQueued(schedule, machineSuccessor(ci, schedule, u));
+
+    propagateQueued(ci, schedule, trail);
+    return Status::Ok;
 }
 
+ScheduleDecoder::Status ScheduleDecoder::redecodeInsertion(
+    Schedule& schedule, const ProblemInstance& instance, int fromIndex, int toIndex,
+    std::vector<TimeChange>* trail) {
+    const CompiledInstance& ci = instance.compiled();
+    const int size = static_cast<int>(schedule.sequence.size());
+
+    if (schedule.layout != &ci || schedule.makespan < 0 ||
+        fromIndex < 0 || fromIndex >= size || toIndex < 0 || toIndex >= size) {
+        return Status::InvalidOperation;
+    }
+    if (fromIndex == toIndex) {
+        return Status::Ok;
+    }
+
+    const int x = schedule.sequence[fromIndex];
+    const int machine = ci.opMachine[x];
+    if (ci.opMachine[schedule.sequence[toIndex]] != machine) {
+        return Status::InvalidOperation; // Farklı makineler
+    }
+
+    scratch.prepare(ci.numOps());
+
+    // Döngü yalnızca x ile atladığı blok arasındaki ters çevrilen sıralardan doğar.
+    // Sağa taşıma: x'in iş ardılından bloktaki son işleme bir yol varsa döngü oluşur;
+    // sola taşıma: bloktaki ilk işlemden x'in iş öncülüne bir yol varsa.
+    // Bloktaki işlemler makinede zincirlendiği için uç işlemi kontrol etmek yeterlidir.
+    if (fromIndex < toIndex) {
+        int last = schedule.sequence[toIndex];
+        int next = jobSuccessor(ci, schedule, x);
+        if (next >= 0) {
+            if (next == last) {
+                return Status::Cycle;
+            }
+            const int limit = schedule.startTime[last];
+            scratch.stack.clear();
+            scratch.stack.push_back(next);
+            scratch.visitStamp[next] = scratch.stamp;
+            while (!scratch.stack.empty()) {
+                int y = scratch.stack.back();
+                scratch.stack.pop_back();
+                int pos = schedule.position[y];
+                if (ci.opMachine[y] == machine && pos > fromIndex && pos <= toIndex) {
+                    return Status::Cycle;
+                }
+                if (schedule.endTime[y] > limit) {
+                    continue; // Buradan bloğa ulaşılamaz
+                }
+                for (int succ : {jobSuccessor(ci, schedule, y), machineSuccessor(ci, schedule, y)}) {
+                    if (succ >= 0 && scratch.visitStamp[succ] != scratch.stamp) {
+                        scratch.visitStamp[succ] = scratch.stamp;
+                        scratch.stack.push_back(succ);
+                    }
+                }
+            }
+        }
+    } else {
+        int first = schedule.sequence[toIndex];
+        if (ci.opIndexOf(x) > 0 && hasPathBackward(ci, schedule, x - 1, first)) {
+            return Status::Cycle;
+        }
+    }
+
+    schedule.moveOperation(fromIndex, toIndex);
+
+    // Başlangıcı değişebilecek işlemler: kaydırılan aralık ve aralıktan sonraki işlem
+    const int lo = std::min(fromIndex, toIndex);
+    const int hi = std::max(fromIndex, toIndex);
+    scratch.heap.clear();
+    for (int i = lo; i <= hi; ++i) {
+        pushQueued(schedule, schedule.sequence[i]);
+    }
+    if (hi + 1 < schedule.machineEnd(machine)) {
+        pushQueued(schedule, schedule.sequence[hi + 1]);
+    }
+
+    propagateQueued(ci, schedule, trail);
+    return Status::Ok;
+}
+
+void ScheduleDecoder::computeTails(const Schedule& schedule, const ProblemInstance& instance,
+                                   std::vector<int>& tails) {
+    computeTails(schedule, instance, tails, scratch);
+}
+
+void ScheduleDecoder::computeTails(const Schedule& schedule, const ProblemInstance& instance,
+                                   std::vector<int>& tails, DecoderWorkspace& workspace) {
+    const CompiledInstance& ci = instance.compiled();
+    const int numOps = ci.numOps();
+
+    tails.assign(numOps, 0);
+
+    // Çıkış derecesi sayaçları ile ters topolojik geçiş
+    std::vector<int>& outDegree = workspace.degree;
+    outDegree.assign(numOps, 0);
+    std::vector<int>& ready = workspace.ready;
+    ready.clear();
+    ready.reserve(numOps);
+    for (int op : schedule.sequence) {
+        outDegree[op] = (jobSuccessor(ci, schedule, op) >= 0) +
+                        (machineSuccessor(ci, schedule, op) >= 0);
+        if (outDegree[op] == 0) {
+            ready.push_back(op);
+        }
+    }
+
+    while (!ready.empty()) {
+        int op = ready.back();
+        ready.pop_back();
+
+        // Tüm ardıllar işlendi: kuyruk = max(ardıl süresi + ardıl kuyruğu)
+        int tail = 0;
+        for (int next : {jobSuccessor(ci, schedule, op), machineSuccessor(ci, schedule, op)}) {
+            if (next >= 0) {
+                tail = std::max(tail, ci.opDuration[next] + tails[next]);
+            }
+        }
+        tails[op] = tail;
+
+        // Öncüllerin çıkış derecesini azalt
+        if (ci.opIndexOf(op) > 0 && --outDegree[op - 1] == 0) {
+            ready.push_back(op - 1);
+        }
+        int pos = schedule.position[op];
+        if (pos > schedule.machineBegin(ci.opMachine[op])) {
+            int prev = schedule.sequence[pos - 1];
+            if (--outDegree[prev] == 0) ready.push_back(prev);
+        }
+    }
+}
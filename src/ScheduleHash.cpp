@@ -0,0 +1,69 @@
+#include "ScheduleHash.h"
+#include <algorithm>
+
+namespace {
+
+// splitmix64 son karıştırıcısı: ardışık anahtarlardan bağımsız görünen 64 bit
+inline std::uint64_t mix(std::uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+// (önceki, sonraki) çiftinin anahtarı; -1 makine başı/sonu işaretidir
+inline std::uint64_t pairKey(int prev, int next) {
+    return mix((static_cast<std::uint64_t>(static_cast<std::uint32_t>(prev + 1)) << 32) |
+               static_cast<std::uint32_t>(next + 1));
+}
+
+} // namespace
+
+std::uint64_t ScheduleHash::compute(const Schedule& schedule) {
+    std::uint64_t hash = 0;
+    for (int m = 0; m < schedule.numMachines(); ++m) {
+        int prev = -1;
+        for (int p = schedule.machineBegin(m); p < schedule.machineEnd(m); ++p) {
+            hash ^= pairKey(prev, schedule.sequence[p]);
+            prev = schedule.sequence[p];
+        }
+        if (prev >= 0) {
+            hash ^= pairKey(prev, -1);
+        }
+    }
+    return hash;
+}
+
+std::uint64_t ScheduleHash::afterInsert(std::uint64_t hash, const Schedule& schedule,
+                                        int from, int to) {
+    if (from == to) {
+        return hash;
+    }
+    const std::vector<int>& seq = schedule.sequence;
+    // Makine: yerleşimden O(1), yoksa offset tablosunda ikili arama
+    const int m = schedule.layout
+        ? schedule.layout->opMachine[seq[from]]
+        : static_cast<int>(std::upper_bound(schedule.machineOffset.begin(),
+                                            schedule.machineOffset.end(), from) -
+                           schedule.machineOffset.begin()) - 1;
+    const int lo = std::min(from, to);
+    const int hi = std::max(from, to);
+    const int before = lo > schedule.machineBegin(m) ? seq[lo - 1] : -1;
+    const int after = hi + 1 < schedule.machineEnd(m) ? seq[hi + 1] : -1;
+    const int x = seq[from];
+
+    if (from < to) {
+        // before, x, s, ..., y, after  ->  before, s, ..., y, x, after
+        const int s = seq[from + 1];
+        const int y = seq[to];
+        hash ^= pairKey(before, x) ^ pairKey(x, s) ^ pairKey(y, after);
+        hash ^= pairKey(before, s) ^ pairKey(y, x) ^ pairKey(x, after);
+    } else {
+        // before, y, ..., s, x, after  ->  before, x, y, ..., s, after
+        const int y = seq[to];
+        const int s = seq[from - 1];
+        hash ^= pairKey(before, y) ^ pairKey(s, x) ^ pairKey(x, after);
+        hash ^= pairKey(before, x) ^ pairKey(x, y) ^ pairKey(s, after);
+    }
+    return hash;
+}
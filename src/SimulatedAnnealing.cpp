@@ -0,0 +1,221 @@
+#include "SimulatedAnnealing.h"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <random>
+
+namespace {
+
+// Kritik bloklardan rastgele bir hamle; ekleme bloğun içindeki işlemi bloğun
+// başına/sonuna taşır, swap bitişik bir çifti değiştirir
+InsertMove randomMove(const std::vector<CriticalBlock>& blocks, const std::vector<int>& movable,
+                      double insertProbability, std::mt19937& rng) {
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    const CriticalBlock& block = blocks[movable[rng() % movable.size()]];
+    if (block.size() >= 3 && unit(rng) < insertProbability) {
+        int from = block.begin + static_cast<int>(rng() % block.size());
+        int to = (from == block.begin) ? block.end
+               : (from == block.end) ? block.begin
+               : (rng() % 2 == 0 ? block.begin : block.end);
+        return InsertMove(from, to);
+    }
+    int p = block.begin + static_cast<int>(rng() % (block.size() - 1));
+    return InsertMove(p, p + 1);
+}
+
+} // namespace
+
+SimulatedAnnealing::SimulatedAnnealing(const ProblemInstance& instance)
+    : instance_(instance) {
+}
+
+AnnealingResult SimulatedAnnealing::run(const Schedule& initialSchedule,
+                                        const AnnealingOptions& options) const {
+    auto started = std::chrono::steady_clock::now();
+    auto elapsed = [&]() {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    };
+
+    AnnealingResult result;
+    Schedule working = initialSchedule;
+    if (!ScheduleDecoder::decode(working, instance_)) {
+        result.best = working;
+        return result; // Çözülemedi
+    }
+    result.initialMakespan = working.makespan;
+    result.bestMakespan = working.makespan;
+    result.lowerBound = LowerBounds::best(instance_);
+
+    std::mt19937 rng(options.seed);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    MoveJournal journal;
+    std::vector<int> movable; // En az iki işlemli blokların indeksleri
+
+    auto traceBlocks = [&]() {
+        CriticalPathAnalyzer::tracePath(working, instance_, path_, blocks_);
+        movable.clear();
+        for (int i = 0; i < static_cast<int>(blocks_.size()); ++i) {
+            if (blocks_[i].size() >= 2) movable.push_back(i);
+        }
+    };
+    traceBlocks();
+
+    // Başlangıç sıcaklığı: ortalama kötüleşme %50 olasılıkla kabul edilecek şekilde
+    double initialTemperature = options.initialTemperature;
+    if (initialTemperature <= 0.0) {
+        double worse = 0.0;
+        int worseCount = 0;
+        for (int k = 0; k < 100 && !movable.empty(); ++k) {
+            InsertMove move = randomMove(blocks_, movable, options.insertProbability, rng);
+            if (!move.apply(working, instance_, journal)) continue;
+            int delta = working.makespan - result.initialMakespan;
+            move.undo(working, journal);
+            if (delta > 0) {
+                worse += delta;
+                ++worseCount;
+            }
+        }
+        initialTemperature = worseCount > 0 ? (worse / worseCount) / std::log(2.0) : 1.0;
+    }
+    const double finalTemperature = std::max(1e-9, std::min(options.finalTemperature,
+                                                            initialTemperature));
+    result.initialTemperature = initialTemperature;
+
+    const long long maxIterations = options.maxIterations > 0 ? options.maxIterations
+                                  : options.timeLimitSeconds > 0.0 ? LLONG_MAX : 100000;
+
+    // Önbellek varsa çalışma çizelgesinin özeti her kabulde O(1) güncellenir
+    const std::shared_ptr<EvaluationCache>& cache = options.cache;
+    std::uint64_t hash = cache ? ScheduleHash::compute(working) : 0;
+
+    // En iyi çizelge tembel kopyalanır: çalışma çizelgesi en iyiyken sadece
+    // bayrak tutulur, en iyiden uzaklaşan ilk kabulde kopya alınır
+    bool workingIsBest = true;
+    double temperature = initialTemperature;
+    long long sinceImprovement = 0;
+    long long iteration = 0;
+    for (; iteration < maxIterations; ++iteration) {
+        if (result.bestMakespan <= std::max(options.targetMakespan, result.lowerBound)) {
+            break; // Hedefe veya alt sınıra (optimal) ulaşıldı
+        }
+        if ((iteration & 63) == 0) {
+            if (options.cancel.isCancelled()) {
+                result.cancelled = true;
+                break;
+            }
+            if (options.timeLimitSeconds > 0.0) {
+                double seconds = elapsed();
+                if (seconds >= options.timeLimitSeconds) {
+                    result.timedOut = true;
+                    break;
+                }
+                if (options.cooling == CoolingSchedule::TimeBased) {
+                    temperature = initialTemperature * std::pow(finalTemperature / initialTemperature,
+                                                                seconds / options.timeLimitSeconds);
+                }
+            }
+        }
+        if (movable.empty()) {
+            // Sadece tek işlemli bloklar: makespan bir iş zinciridir, çizelge optimaldir
+            // (en iyi kayıtla aynı makespan'a sahip)
+            break;
+        }
+
+        // Isıtma: en iyi çözüme dön ve sıcaklığı yükselt
+        if (options.reheatAfter > 0 && sinceImprovement >= options.reheatAfter) {
+            if (!workingIsBest) {
+                working = result.best;
+                workingIsBest = true;
+                if (cache) hash = ScheduleHash::compute(working);
+                traceBlocks();
+            }
+            temperature = std::max(temperature, initialTemperature * options.reheatRatio);
+            sinceImprovement = 0;
+            ++result.reheats;
+            continue;
+        }
+
+        // Metropolis ölçütü; reddedilen hamle geri alınır. Önbellekte bulunan
+        // komşu sadece kabul edilirse uygulanır.
+        InsertMove move = randomMove(blocks_, movable, options.insertProbability, rng);
+        const int current = working.makespan;
+        ++sinceImprovement;
+        int makespan = -1;
+        bool applied = false;
+        std::uint64_t candidateHash = cache ? move.hashAfter(working, hash) : 0;
+        if (cache && cache->lookup(candidateHash, makespan)) {
+            ++result.cacheHits;
+        } else {
+            ++result.decodes;
+            applied = move.apply(working, instance_, journal);
+            makespan = applied ? working.makespan : -1;
+            if (cache) cache->insert(candidateHash, makespan);
+        }
+        if (makespan >= 0) {
+            int delta = makespan - current;
+            bool accept = delta <= 0 || unit(rng) < std::exp(-delta / temperature);
+            if (accept && !applied) {
+                // Önbellekten gelen değer kabul anında doğrulanır: özet çakışmasında
+                // kayıt düzeltilir ve hamle reddedilir
+                applied = move.apply(working, instance_, journal);
+                if (!applied || working.makespan != makespan) {
+                    cache->insert(candidateHash, applied ? working.makespan : -1);
+                    if (applied) {
+                        move.undo(working, journal);
+                    }
+                    applied = false;
+                    accept = false;
+                }
+            }
+            if (accept) {
+                hash = candidateHash;
+                ++result.accepted;
+                if (working.makespan < result.bestMakespan) {
+                    result.bestMakespan = working.makespan;
+                    workingIsBest = true;
+                    sinceImprovement = 0;
+                    if (options.onImprovement) {
+                        options.onImprovement(working, working.makespan);
+                    }
+                } else if (workingIsBest) {
+                    // En iyiden ayrılıyoruz: önceki durumu sakla ve hamleyi yeniden uygula
+                    move.undo(working, journal);
+                    result.best = working;
+                    move.apply(working, instance_, journal);
+                    workingIsBest = false;
+                }
+                traceBlocks();
+            } else if (applied) {
+                move.undo(working, journal);
+            }
+        }
+
+        switch (options.cooling) {
+        case CoolingSchedule::Geometric:
+            if ((iteration + 1) % std::max(1, options.stepsPerTemperature) == 0) {
+                temperature = std::max(finalTemperature, temperature * options.coolingRate);
+            }
+            break;
+        case CoolingSchedule::LundyMees:
+            temperature = std::max(finalTemperature,
+                                   temperature / (1.0 + options.lundyMeesBeta * temperature));
+            break;
+        case CoolingSchedule::TimeBased:
+            if (options.timeLimitSeconds <= 0.0) {
+                // Süre bütçesi yoksa iterasyon sınırına göre aynı üstel eğri
+                double fraction = static_cast<double>(iteration + 1) / maxIterations;
+                temperature = initialTemperature *
+                    std::pow(finalTemperature / initialTemperature, fraction);
+            }
+            break;
+        }
+    }
+
+    if (workingIsBest) {
+        result.best = std::move(working);
+    }
+    result.iterations = iteration;
+    result.wallSeconds = elapsed();
+    return result;
+}
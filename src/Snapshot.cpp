@@ -0,0 +1,436 @@
+#include "Snapshot.h"
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_set>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "nlohmann/json.hpp"
+
+static_assert(sizeof(int) == sizeof(std::int32_t), "Snapshot arrays are stored as int32");
+static_assert(sizeof(SnapshotHeader) % 8 == 0, "Sections must stay 8-byte aligned");
+
+namespace {
+
+constexpr char kMagic[8] = {'J', 'S', 'S', 'P', 'S', 'N', 'A', 'P'};
+constexpr std::uint32_t kByteOrder = 0x01020304;
+constexpr int kInstanceSections = 8;
+constexpr int kScheduleSections = 4;
+
+void fail(const std::string& msg) {
+    throw std::runtime_error("Snapshot error: " + msg);
+}
+
+// FNV-1a (64 bit)
+struct Fnv1a {
+    std::uint64_t hash = 14695981039346656037ull;
+
+    void bytes(const void* data, std::size_t size) {
+        const unsigned char* p = static_cast<const unsigned char*>(data);
+        for (std::size_t i = 0; i < size; ++i) {
+            hash ^= p[i];
+            hash *= 1099511628211ull;
+        }
+    }
+
+    void ints(const std::vector<int>& v) { bytes(v.data(), v.size() * sizeof(int)); }
+
+    void string(const std::string& s) {
+        std::uint32_t size = static_cast<std::uint32_t>(s.size());
+        bytes(&size, sizeof(size));
+        bytes(s.data(), s.size());
+    }
+};
+
+std::uint64_t align8(std::uint64_t offset) {
+    return (offset + 7) & ~static_cast<std::uint64_t>(7);
+}
+
+// Bölümleri sırayla yerleştirip başlık ile birlikte yazar
+class SectionWriter {
+private:
+    struct Section {
+        const void* data;
+        std::size_t size;
+    };
+    std::vector<Section> sections_;
+
+public:
+    void add(const void* data, std::size_t size) { sections_.push_back(Section{data, size}); }
+
+    void add(const std::vector<int>& v) { add(v.data(), v.size() * sizeof(int)); }
+
+    void write(SnapshotHeader& header, const std::string& path) const {
+        std::uint64_t offset = sizeof(SnapshotHeader);
+        header.sectionCount = static_cast<std::uint32_t>(sections_.size());
+        for (size_t i = 0; i < sections_.size(); ++i) {
+            header.sectionOffset[i] = offset;
+            offset = align8(offset + sections_[i].size);
+        }
+        header.fileSize = offset;
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) fail("cannot open " + path + " for writing");
+
+        static const char padding[8] = {};
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        for (const Section& s : sections_) {
+            out.write(static_cast<const char*>(s.data), static_cast<std::streamsize>(s.size));
+            out.write(padding, static_cast<std::streamsize>(align8(s.size) - s.size));
+        }
+        if (!out) fail("write failed: " + path);
+    }
+};
+
+SnapshotHeader makeHeader(SnapshotKind kind) {
+    SnapshotHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = Snapshot::kVersion;
+    header.kind = static_cast<std::uint32_t>(kind);
+    header.byteOrder = kByteOrder;
+    header.headerSize = sizeof(SnapshotHeader);
+    header.makespan = -1;
+    header.makespanOp = -1;
+    return header;
+}
+
+// Başlığı doğrular (sihirli sayı, bayt sırası, sürüm, tür, boyut)
+const SnapshotHeader* checkHeader(const MappedFile& file, SnapshotKind kind, const std::string& path) {
+    if (file.size() < sizeof(SnapshotHeader)) fail(path + " is too small");
+    const SnapshotHeader* header = reinterpret_cast<const SnapshotHeader*>(file.data());
+
+    if (std::memcmp(header->magic, kMagic, sizeof(kMagic)) != 0) fail(path + " is not a snapshot");
+    if (header->byteOrder != kByteOrder) fail(path + " was written with a different byte order");
+    if (header->version != Snapshot::kVersion) {
+        fail(path + " has unsupported version " + std::to_string(header->version));
+    }
+    if (header->headerSize != sizeof(SnapshotHeader)) fail(path + " has an unexpected header size");
+    if (header->kind != static_cast<std::uint32_t>(kind)) fail(path + " holds a different kind of snapshot");
+    if (header->fileSize != file.size()) fail(path + " is truncated");
+    if (header->numJobs < 0 || header->numMachines < 0 || header->numOps < 0) {
+        fail(path + " has negative counts");
+    }
+    return header;
+}
+
+// Bölümlerin hizalı olduğunu ve dosya içinde kaldığını doğrular
+void checkSections(const MappedFile& file, const SnapshotHeader* header,
+                   const std::vector<std::uint64_t>& sectionBytes, const std::string& path) {
+    if (header->sectionCount != sectionBytes.size()) fail(path + " has a wrong section count");
+
+    for (size_t i = 0; i < sectionBytes.size(); ++i) {
+        std::uint64_t offset = header->sectionOffset[i];
+        if (offset % 8 != 0 || offset < sizeof(SnapshotHeader) || offset > file.size() ||
+            sectionBytes[i] > file.size() - offset) {
+            fail(path + " section " + std::to_string(i) + " is out of bounds");
+        }
+    }
+}
+
+bool inRange(const std::int32_t* v, std::size_t n, std::int32_t lo, std::int32_t hi) {
+    for (std::size_t i = 0; i < n; ++i) {
+        if (v[i] < lo || v[i] >= hi) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+// --------------------
+// MappedFile
+// --------------------
+MappedFile::MappedFile(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) fail("cannot open " + path);
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        fail("cannot stat " + path);
+    }
+    size_ = static_cast<std::size_t>(st.st_size);
+
+    if (size_ > 0) {
+        void* p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED) {
+            ::close(fd);
+            fail("cannot map " + path);
+        }
+        data_ = static_cast<const unsigned char*>(p);
+    }
+    ::close(fd); // Eşleme dosya tanıtıcısından bağımsız yaşar
+}
+
+MappedFile::~MappedFile() {
+    if (data_) ::munmap(const_cast<unsigned char*>(data_), size_);
+}
+
+// --------------------
+// MappedInstance
+// --------------------
+MappedInstance::MappedInstance(const std::string& path) : file_(path) {
+    header_ = checkHeader(file_, SnapshotKind::Instance, path);
+
+    const std::uint64_t J = static_cast<std::uint64_t>(header_->numJobs);
+    const std::uint64_t M = static_cast<std::uint64_t>(header_->numMachines);
+    const std::uint64_t N = static_cast<std::uint64_t>(header_->numOps);
+    checkSections(file_, header_,
+                  {(J + 1) * 4, N * 4, N * 4, N * 4, J * 4, N * 4, M * 4, (J + M + 1) * 4}, path);
+
+    // Görünüm okuyucularının dizinleri güvenle kullanabilmesi için aralık kontrolleri
+    const std::int32_t* offsets = jobOffset();
+    if (offsets[0] != 0 || offsets[numJobs()] != numOps()) fail(path + " has invalid job offsets");
+    for (int j = 0; j < numJobs(); ++j) {
+        if (offsets[j] > offsets[j + 1]) fail(path + " has invalid job offsets");
+    }
+    if (!inRange(opJob(), N, 0, numJobs()) || !inRange(opMachine(), N, 0, numMachines())) {
+        fail(path + " has out-of-range indices");
+    }
+
+    const std::uint32_t* strings = stringOffsets();
+    const std::uint64_t charsBegin = header_->sectionOffset[7] + (J + M + 1) * 4;
+    if (strings[0] != 0) fail(path + " has an invalid string table");
+    for (std::uint64_t i = 0; i < J + M; ++i) {
+        if (strings[i] > strings[i + 1]) fail(path + " has an invalid string table");
+    }
+    if (strings[J + M] > file_.size() - charsBegin) fail(path + " has an invalid string table");
+
+    // Kimlikler kendi grubunda tekil olmalı (iş ve makine aynı adı taşıyabilir)
+    std::unordered_set<std::string_view> seen;
+    seen.reserve(J);
+    for (int j = 0; j < numJobs(); ++j) {
+        if (!seen.insert(jobId(j)).second) fail(path + " has duplicate job ids");
+    }
+    seen.clear();
+    for (int m = 0; m < numMachines(); ++m) {
+        if (!seen.insert(machineId(m)).second) fail(path + " has duplicate machine ids");
+    }
+
+    // opJob iş aralıklarıyla, türetilmiş diziler de birincil dizilerle tutarlı olmalı:
+    // opIndexOf, çözücü ve boyut olarak kullanan okuyucular (BatchEvaluator,
+    // LowerBounds) bunlara dosyadan geldiği gibi güvenir
+    const std::int32_t* jobOf = opJob();
+    const std::int32_t* machineOf = opMachine();
+    const std::int32_t* duration = opDuration();
+    const std::int32_t* remaining = remainingWork();
+    const std::int32_t* total = jobTotalTime();
+    for (int j = 0; j < numJobs(); ++j) {
+        std::int64_t rest = 0;
+        for (int op = offsets[j + 1] - 1; op >= offsets[j]; --op) {
+            if (jobOf[op] != j) fail(path + " has operations outside their job's range");
+            if (duration[op] <= 0) fail(path + " has non-positive durations");
+            rest += duration[op];
+            if (remaining[op] != rest) fail(path + " has inconsistent remaining work");
+        }
+        if (total[j] != rest) fail(path + " has inconsistent job totals");
+    }
+    std::vector<std::int64_t> opsOnMachine(M, 0);
+    for (std::uint64_t op = 0; op < N; ++op) {
+        opsOnMachine[machineOf[op]]++;
+    }
+    for (int m = 0; m < numMachines(); ++m) {
+        if (machineOpCount()[m] != opsOnMachine[m]) fail(path + " has inconsistent machine op counts");
+    }
+}
+
+std::string_view MappedInstance::stringAt(int index) const {
+    const std::uint32_t* offsets = stringOffsets();
+    const char* chars = reinterpret_cast<const char*>(offsets + numJobs() + numMachines() + 1);
+    return std::string_view(chars + offsets[index], offsets[index + 1] - offsets[index]);
+}
+
+ProblemInstance MappedInstance::toProblemInstance() const {
+    const int J = numJobs();
+    const int M = numMachines();
+    const int N = numOps();
+
+    auto c = std::make_unique<CompiledInstance>();
+    c->jobOffset.assign(jobOffset(), jobOffset() + J + 1);
+    c->opJob.assign(opJob(), opJob() + N);
+    c->opMachine.assign(opMachine(), opMachine() + N);
+    c->opDuration.assign(opDuration(), opDuration() + N);
+    c->jobTotalTime.assign(jobTotalTime(), jobTotalTime() + J);
+    c->remainingWork.assign(remainingWork(), remainingWork() + N);
+    c->machineOpCount.assign(machineOpCount(), machineOpCount() + M);
+
+    ProblemInstance inst;
+    c->machineIds.reserve(M);
+    for (int m = 0; m < M; ++m) {
+        c->machineIds.emplace_back(machineId(m));
+        inst.machines.emplace(c->machineIds[m], std::make_unique<Machine>(c->machineIds[m]));
+        inst.intern(c->machineIds[m]);  // sırayla: kimlik = yoğun makine indeksi
+    }
+
+    c->jobIds.reserve(J);
+    for (int j = 0; j < J; ++j) {
+        c->jobIds.emplace_back(jobId(j));
+        inst.intern(c->jobIds[j]);
+    }
+    c->bindIds(inst.ids);
+
+    for (int j = 0; j < J; ++j) {
+        const std::string& jid = c->jobIds[j];
+
+        std::vector<Operation> ops;
+        ops.reserve(c->jobLength(j));
+        for (int op = c->jobOffset[j]; op < c->jobOffset[j + 1]; ++op) {
+            ops.emplace_back(op - c->jobOffset[j], c->opMachine[op], c->opDuration[op]);
+        }
+        inst.jobs.emplace(jid, std::make_unique<Job>(jid, std::move(ops)));
+    }
+
+    inst.adoptCompiled(std::move(c));
+    return inst;
+}
+
+// --------------------
+// Snapshot
+// --------------------
+std::uint64_t Snapshot::fingerprint(const CompiledInstance& ci) {
+    Fnv1a h;
+    std::int32_t counts[3] = {ci.numJobs(), ci.numMachines(), ci.numOps()};
+    h.bytes(counts, sizeof(counts));
+    for (const std::string& id : ci.jobIds) h.string(id);
+    for (const std::string& id : ci.machineIds) h.string(id);
+    h.ints(ci.jobOffset);
+    h.ints(ci.opMachine);
+    h.ints(ci.opDuration);
+    return h.hash;
+}
+
+void Snapshot::writeInstance(const ProblemInstance& instance, const std::string& path) {
+    const CompiledInstance& ci = instance.compiled();
+
+    SnapshotHeader header = makeHeader(SnapshotKind::Instance);
+    header.fingerprint = fingerprint(ci);
+    header.numJobs = ci.numJobs();
+    header.numMachines = ci.numMachines();
+    header.numOps = ci.numOps();
+
+    // Dize tablosu: ofsetler + art arda karakterler
+    std::vector<std::uint32_t> stringOffsets{0};
+    std::string chars;
+    for (const auto* ids : {&ci.jobIds, &ci.machineIds}) {
+        for (const std::string& id : *ids) {
+            chars += id;
+            stringOffsets.push_back(static_cast<std::uint32_t>(chars.size()));
+        }
+    }
+    std::vector<char> table(stringOffsets.size() * sizeof(std::uint32_t) + chars.size());
+    std::memcpy(table.data(), stringOffsets.data(), stringOffsets.size() * sizeof(std::uint32_t));
+    std::memcpy(table.data() + stringOffsets.size() * sizeof(std::uint32_t), chars.data(), chars.size());
+
+    SectionWriter writer;
+    writer.add(ci.jobOffset);
+    writer.add(ci.opJob);
+    writer.add(ci.opMachine);
+    writer.add(ci.opDuration);
+    writer.add(ci.jobTotalTime);
+    writer.add(ci.remainingWork);
+    writer.add(ci.machineOpCount);
+    writer.add(table.data(), table.size());
+    static_assert(kInstanceSections == 8, "Instance section list changed");
+    writer.write(header, path);
+}
+
+void Snapshot::writeSchedule(const Schedule& schedule, const std::string& path) {
+    if (!schedule.layout) fail("schedule has no layout");
+    const CompiledInstance& ci = *schedule.layout;
+
+    SnapshotHeader header = makeHeader(SnapshotKind::Schedule);
+    header.fingerprint = fingerprint(ci);
+    header.numJobs = ci.numJobs();
+    header.numMachines = ci.numMachines();
+    header.numOps = ci.numOps();
+    header.numSequenced = static_cast<std::int32_t>(schedule.sequence.size());
+    header.makespan = schedule.makespan;
+    header.makespanOp = schedule.makespanOp;
+
+    SectionWriter writer;
+    writer.add(schedule.machineOffset);
+    writer.add(schedule.sequence);
+    writer.add(schedule.startTime);
+    writer.add(schedule.endTime);
+    static_assert(kScheduleSections == 4, "Schedule section list changed");
+    writer.write(header, path);
+}
+
+Schedule Snapshot::readSchedule(const ProblemInstance& instance, const std::string& path) {
+    const CompiledInstance& ci = instance.compiled();
+    MappedFile file(path);
+
+    const SnapshotHeader* header = checkHeader(file, SnapshotKind::Schedule, path);
+    if (header->fingerprint != fingerprint(ci) || header->numMachines != ci.numMachines() ||
+        header->numOps != ci.numOps()) {
+        fail(path + " belongs to a different instance");
+    }
+
+    const std::uint64_t M = static_cast<std::uint64_t>(ci.numMachines());
+    const std::uint64_t N = static_cast<std::uint64_t>(ci.numOps());
+    if (header->numSequenced < 0 || static_cast<std::uint64_t>(header->numSequenced) > N) {
+        fail(path + " has an invalid sequence length");
+    }
+    const std::uint64_t S = static_cast<std::uint64_t>(header->numSequenced);
+    checkSections(file, header, {(M + 1) * 4, S * 4, N * 4, N * 4}, path);
+
+    auto section = [&](int i) {
+        return reinterpret_cast<const std::int32_t*>(file.data() + header->sectionOffset[i]);
+    };
+
+    Schedule s(ci);
+    s.machineOffset.assign(section(0), section(0) + M + 1);
+    s.sequence.assign(section(1), section(1) + S);
+    s.startTime.assign(section(2), section(2) + N);
+    s.endTime.assign(section(3), section(3) + N);
+    s.makespan = header->makespan;
+    s.makespanOp = header->makespanOp;
+
+    // Makine sınırları ve işlem indeksleri geçerli olmalı; position yeniden kurulur
+    if (s.machineOffset[0] != 0 || s.machineOffset[M] != static_cast<int>(S)) {
+        fail(path + " has invalid machine offsets");
+    }
+    for (std::uint64_t m = 0; m < M; ++m) {
+        if (s.machineOffset[m] > s.machineOffset[m + 1]) fail(path + " has invalid machine offsets");
+    }
+    for (std::uint64_t p = 0; p < S; ++p) {
+        int op = s.sequence[p];
+        if (op < 0 || op >= ci.numOps() || s.position[op] >= 0) {
+            fail(path + " has an invalid sequence");
+        }
+        s.position[op] = static_cast<int>(p);
+    }
+    if (s.makespanOp < -1 || s.makespanOp >= ci.numOps()) fail(path + " has an invalid makespan op");
+    return s;
+}
+
+void Snapshot::writeInstanceJson(const ProblemInstance& instance, const std::string& path) {
+    const CompiledInstance& ci = instance.compiled();
+    std::ofstream out(path, std::ios::trunc);
+    if (!out) fail("cannot open " + path + " for writing");
+
+    // İş başına bir satır; id'ler nlohmann ile kaçışlanır (DOM kurulmaz)
+    auto quoted = [](const std::string& s) { return nlohmann::json(s).dump(); };
+
+    out << "{\n  \"machines\": [";
+    for (int m = 0; m < ci.numMachines(); ++m) {
+        out << (m ? ", " : "") << quoted(ci.machineIds[m]);
+    }
+    out << "],\n  \"jobs\": [\n";
+    for (int j = 0; j < ci.numJobs(); ++j) {
+        out << "    {\"id\": " << quoted(ci.jobIds[j]) << ", \"operations\": [";
+        for (int op = ci.jobOffset[j]; op < ci.jobOffset[j + 1]; ++op) {
+            out << (op > ci.jobOffset[j] ? ", " : "")
+                << "{\"machine\": " << quoted(ci.machineIds[ci.opMachine[op]])
+                << ", \"duration\": " << ci.opDuration[op] << "}";
+        }
+        out << "]}" << (j + 1 < ci.numJobs() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+    if (!out) fail("write failed: " + path);
+}
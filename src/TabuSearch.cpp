@@ -0,0 +1,385 @@
+#include "TabuSearch.h"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+// Tabu anahtarı: "a, b'den önce" sırası
+inline std::uint64_t orderKey(int a, int b) {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(a)) << 32) |
+           static_cast<std::uint32_t>(b);
+}
+
+// Ters çevrilen sıraların son yasak iterasyonu: doğrusal yoklamalı, önceden
+// ayrılmış düz tablo. Kayıt eklemek düğüm ayırmaz; süresi dolmuş kayıtlar tablo
+// dolunca yerinde yeniden kurulurken atılır, tablo sadece canlı kayıtlar için
+// yer kalmazsa büyür (ısınma sırasında).
+class TabuList {
+private:
+    struct Slot {
+        std::uint64_t key = 0;
+        long long expiry = -1; // < 0: boş yuva
+    };
+
+    std::vector<Slot> slots_;
+    std::vector<Slot> live_;   // Yeniden kurmada karalama
+    int shift_ = 64;
+    std::size_t used_ = 0;
+
+    std::size_t home(std::uint64_t key) const {
+        return static_cast<std::size_t>((key * 0x9e3779b97f4a7c15ULL) >> shift_);
+    }
+
+    void allocate(std::size_t capacity) {
+        int bits = 4;
+        while ((std::size_t(1) << bits) < capacity) ++bits;
+        slots_.assign(std::size_t(1) << bits, Slot());
+        shift_ = 64 - bits;
+        used_ = 0;
+    }
+
+    void put(std::uint64_t key, long long until) {
+        const std::size_t mask = slots_.size() - 1;
+        for (std::size_t i = home(key);; i = (i + 1) & mask) {
+            Slot& slot = slots_[i];
+            if (slot.expiry < 0) {
+                slot = Slot{key, until};
+                ++used_;
+                return;
+            }
+            if (slot.key == key) {
+                slot.expiry = until;
+                return;
+            }
+        }
+    }
+
+    // Süresi dolanları atıp canlıları yeniden yerleştirir; eklenecek kayıtlarla
+    // birlikte yarıdan fazlasını dolduracaklarsa tabloyu büyütür
+    void rebuild(long long iteration, std::size_t incoming) {
+        live_.clear();
+        for (const Slot& slot : slots_) {
+            if (slot.expiry > iteration) live_.push_back(slot);
+        }
+        std::size_t capacity = slots_.size();
+        while ((live_.size() + incoming) * 2 > capacity) capacity *= 2;
+        if (capacity != slots_.size()) {
+            allocate(capacity);
+        } else {
+            std::fill(slots_.begin(), slots_.end(), Slot());
+            used_ = 0;
+        }
+        for (const Slot& slot : live_) put(slot.key, slot.expiry);
+    }
+
+    bool forbidden(int a, int b, long long iteration) const {
+        const std::uint64_t key = orderKey(a, b);
+        const std::size_t mask = slots_.size() - 1;
+        for (std::size_t i = home(key);; i = (i + 1) & mask) {
+            const Slot& slot = slots_[i];
+            if (slot.expiry < 0) return false;
+            if (slot.key == key) return slot.expiry > iteration;
+        }
+    }
+
+public:
+    // Tipik canlı kayıt sayısı tenure x blok uzunluğudur; işlem sayısına göre
+    // ayrılan başlangıç kapasitesi bunu çoğu zaman hiç büyümeden karşılar
+    explicit TabuList(int numOps) {
+        allocate(std::min<std::size_t>(std::size_t(1) << 16, 4 * static_cast<std::size_t>(numOps) + 64));
+        live_.reserve(slots_.size());
+    }
+
+    void clear() {
+        std::fill(slots_.begin(), slots_.end(), Slot());
+        used_ = 0;
+    }
+
+    // Hamle, yasaklı bir sırayı geri getiriyor mu?
+    bool isTabu(const Schedule& s, const InsertMove& move, long long iteration) const {
+        int x = s.sequence[move.from];
+        if (move.from < move.to) {
+            // x sağa taşınır: aradaki y'ler x'ten önce gelir
+            for (int i = move.from + 1; i <= move.to; ++i) {
+                if (forbidden(s.sequence[i], x, iteration)) return true;
+            }
+        } else {
+            // x sola taşınır: x aradaki y'lerden önce gelir
+            for (int i = move.to; i < move.from; ++i) {
+                if (forbidden(x, s.sequence[i], iteration)) return true;
+            }
+        }
+        return false;
+    }
+
+    // Hamle uygulandıktan sonra çağrılır (s: yeni sıra): bozulan sıraları yasaklar
+    void record(const Schedule& s, const InsertMove& move, long long until, long long iteration) {
+        // Yoklama zincirleri kısa kalsın: tablo dörtte üç dolunca yeniden kur
+        const std::size_t added = static_cast<std::size_t>(std::abs(move.to - move.from));
+        if ((used_ + added) * 4 > slots_.size() * 3) {
+            rebuild(iteration, added);
+        }
+
+        // x artık 'to' konumunda; aradaki işlemler bir kaydı
+        int x = s.sequence[move.to];
+        if (move.from < move.to) {
+            for (int i = move.from; i < move.to; ++i) {
+                put(orderKey(x, s.sequence[i]), until);
+            }
+        } else {
+            for (int i = move.to + 1; i <= move.from; ++i) {
+                put(orderKey(s.sequence[i], x), until);
+            }
+        }
+    }
+};
+
+} // namespace
+
+TabuSearch::TabuSearch(const ProblemInstance& instance)
+    : instance_(instance) {
+}
+
+void TabuSearch::collectMoves(const Schedule& schedule, TabuNeighborhood neighborhood,
+                              std::vector<InsertMove>& moves) const {
+    const CompiledInstance& ci = instance_.compiled();
+    moves.clear();
+    if (schedule.makespanOp < 0) {
+        return;
+    }
+    if (neighborhood == TabuNeighborhood::N6) {
+        ScheduleDecoder::computeTails(schedule, instance_, tails_);
+    }
+
+    CriticalPathAnalyzer::tracePath(schedule, instance_, path_, blocks_);
+
+    // Tek blok: makespan bir makinenin kesintisiz yüküdür, çizelge optimaldir
+    const int numBlocks = static_cast<int>(blocks_.size());
+    for (int i = 0; i < numBlocks; ++i) {
+        const int b = blocks_[i].begin;
+        const int e = blocks_[i].end;
+        if (e == b) {
+            continue;
+        }
+        bool notFirst = i > 0;
+        bool notLast = i + 1 < numBlocks;
+
+        if (neighborhood == TabuNeighborhood::N5) {
+            // İlk blokta sadece son çift, son blokta sadece ilk çift
+            if (notFirst) {
+                moves.emplace_back(b, b + 1);
+            }
+            if (notLast && !(notFirst && e == b + 1)) {
+                moves.emplace_back(e - 1, e);
+            }
+        } else {
+            // Blok içindeki işlemi bloğun başına veya sonuna taşı. Sadece
+            // Balas–Vazacopoulos yeter koşuluyla döngüsüz olduğu bilinen taşımalar
+            // üretilir (bitişik swap'lar her zaman döngüsüzdür).
+            int first = schedule.sequence[b];
+            int last = schedule.sequence[e];
+            if (notFirst) {
+                for (int p = b + 1; p <= e; ++p) {
+                    int v = schedule.sequence[p];
+                    // v, first'ün önüne: end[first] >= end[iş öncülü(v)]
+                    if (p == b + 1 || ci.opIndexOf(v) == 0 ||
+                        schedule.endTime[first] >= schedule.endTime[v - 1]) {
+                        moves.emplace_back(p, b);
+                    }
+                }
+            }
+            if (notLast) {
+                for (int p = b; p < e; ++p) {
+                    if (notFirst && p == b && e == b + 1) {
+                        continue; // Aynı swap yukarıda eklendi
+                    }
+                    int u = schedule.sequence[p];
+                    // u, last'ın arkasına: p[last] + q[last] >= p[iş ardılı(u)] + q[iş ardılı(u)]
+                    int next = u + 1;
+                    if (p == e - 1 || next >= ci.jobOffset[ci.opJob[u] + 1] ||
+                        ci.opDuration[last] + tails_[last] >=
+                            ci.opDuration[next] + tails_[next]) {
+                        moves.emplace_back(p, e);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TabuResult TabuSearch::run(const Schedule& initialSchedule, const TabuOptions& options) const {
+    const CompiledInstance& ci = instance_.compiled();
+    auto started = std::chrono::steady_clock::now();
+    auto elapsed = [&]() {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    };
+
+    TabuResult result;
+    Schedule working = initialSchedule;
+    if (!ScheduleDecoder::decode(working, instance_)) {
+        result.best = working;
+        return result; // Çözülemedi
+    }
+
+    result.initialMakespan = MakespanCalculator::calculate(working);
+    result.lowerBound = LowerBounds::best(instance_);
+    result.best = working;
+    result.bestMakespan = result.initialMakespan;
+
+    // Elit havuz: son bulunan en iyi çözümler (en yenisi sonda)
+    std::vector<Schedule> elite;
+    elite.reserve(std::max(1, options.eliteSize));
+    elite.push_back(working);
+
+    std::mt19937 rng(options.seed);
+    std::uniform_int_distribution<int> tenureExtra(0, std::max(0, options.tenureSpread));
+    TabuList tabu(ci.numOps());
+    std::vector<InsertMove> moves;
+    moves.reserve(2 * static_cast<std::size_t>(ci.numOps())); // Her bloktaki işlem en fazla iki hamle üretir
+    MoveJournal journal;
+    journal.changes.reserve(ci.numOps()); // Bir hamlenin kaydı pratikte işlem sayısını aşmaz
+    long long stagnation = 0;
+
+    // Önbellek varsa çalışma çizelgesinin özeti her hamleyle O(1) güncellenir
+    const std::shared_ptr<EvaluationCache>& cache = options.cache;
+    std::uint64_t hash = cache ? ScheduleHash::compute(working) : 0;
+    auto applyMove = [&](const InsertMove& move) {
+        std::uint64_t next = cache ? move.hashAfter(working, hash) : 0;
+        if (move.apply(working, instance_, journal)) {
+            hash = next;
+        }
+    };
+
+    auto restart = [&]() {
+        working = elite[rng() % elite.size()];
+        if (cache) hash = ScheduleHash::compute(working);
+        tabu.clear();
+        stagnation = 0;
+        ++result.restarts;
+
+        // Aynı yörüngeyi tekrar izlememek için birkaç rastgele kritik hamle uygula
+        for (int k = 0; k < options.perturbationMoves; ++k) {
+            collectMoves(working, options.neighborhood, moves);
+            if (moves.empty()) {
+                break;
+            }
+            applyMove(moves[rng() % moves.size()]);
+        }
+    };
+
+    long long iteration = 0;
+    for (; iteration < options.maxIterations; ++iteration) {
+        if (result.bestMakespan <= std::max(options.targetMakespan, result.lowerBound)) {
+            break; // Hedefe veya alt sınıra (optimal) ulaşıldı
+        }
+        // Her iterasyon bütün komşuluğu değerlendirir; saate bakmak bunun yanında
+        // ihmal edilebilir, son tarih en fazla bir tarama kadar aşılır
+        if (options.timeLimitSeconds > 0.0 && elapsed() >= options.timeLimitSeconds) {
+            break;
+        }
+        if (options.cancel.isCancelled()) {
+            result.cancelled = true;
+            break;
+        }
+
+        collectMoves(working, options.neighborhood, moves);
+        if (moves.empty()) {
+            if (working.makespan <= result.bestMakespan) {
+                break; // Tek kritik blok: optimal
+            }
+            restart();
+            continue;
+        }
+
+        // En iyi yasaksız (veya aspirasyonu sağlayan) hamle; hepsi yasaklıysa en iyi yasaklı
+        int chosen = -1;
+        int chosenMakespan = INT_MAX;
+        int fallback = -1;
+        int fallbackMakespan = INT_MAX;
+        for (int i = 0; i < static_cast<int>(moves.size()); ++i) {
+            const InsertMove& move = moves[i];
+            bool isTabu = tabu.isTabu(working, move, iteration);
+            int makespan = -1;
+            std::uint64_t candidateHash = 0;
+            if (cache) {
+                candidateHash = move.hashAfter(working, hash);
+            }
+            if (cache && cache->lookup(candidateHash, makespan)) {
+                ++result.cacheHits;
+            } else {
+                ++result.decodes;
+                if (move.apply(working, instance_, journal)) {
+                    makespan = working.makespan;
+                    move.undo(working, journal);
+                }
+                if (cache) cache->insert(candidateHash, makespan);
+            }
+            if (makespan < 0) {
+                continue; // Döngü oluşturuyor
+            }
+
+            if (!isTabu || makespan < result.bestMakespan) {
+                if (makespan < chosenMakespan) {
+                    chosen = i;
+                    chosenMakespan = makespan;
+                }
+            } else if (makespan < fallbackMakespan) {
+                fallback = i;
+                fallbackMakespan = makespan;
+            }
+        }
+        if (chosen < 0) {
+            chosen = fallback;
+            chosenMakespan = fallbackMakespan;
+        }
+        if (chosen < 0) {
+            restart(); // Uygulanabilir hamle yok
+            continue;
+        }
+
+        const InsertMove& move = moves[chosen];
+        // Seçilen hamlenin önbellekten okunan değeri uygulanırken doğrulanır: özet
+        // çakışmasında kayıt düzeltilir, hamle geri alınır ve sonraki iterasyon düzeltilmiş
+        // değerlerle yeniden seçer. Yapılmayan bir hamle tabu listesine girmez.
+        std::uint64_t next = cache ? move.hashAfter(working, hash) : 0;
+        if (!move.apply(working, instance_, journal)) {
+            if (cache) cache->insert(next, -1);
+            continue;
+        }
+        if (cache && working.makespan != chosenMakespan) {
+            cache->insert(next, working.makespan);
+            move.undo(working, journal);
+            continue;
+        }
+        tabu.record(working, move, iteration + options.tabuTenure + tenureExtra(rng), iteration);
+        hash = next;
+
+        if (working.makespan < result.bestMakespan) {
+            result.best = working;
+            result.bestMakespan = working.makespan;
+            stagnation = 0;
+            if (options.onImprovement) {
+                options.onImprovement(result.best, result.bestMakespan);
+            }
+
+            // Havuz doluysa en eskisinin tamponları yeniden kullanılır (ayırma yok)
+            if (static_cast<int>(elite.size()) < std::max(1, options.eliteSize)) {
+                elite.push_back(working);
+            } else {
+                std::rotate(elite.begin(), elite.begin() + 1, elite.end());
+                elite.back() = working;
+            }
+        } else if (++stagnation >= options.maxStagnation) {
+            restart();
+        }
+    }
+
+    result.iterations = iteration;
+    result.wallSeconds = elapsed();
+    return result;
+}
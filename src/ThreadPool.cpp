@@ -0,0 +1,111 @@
+#include "ThreadPool.h"
+#include <algorithm>
+
+ThreadPool::ThreadPool(int threadCount) {
+    if (threadCount <= 0) {
+        threadCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+
+    // Çağıran iş parçacığı 0 numaralı işçidir
+    threads_.reserve(threadCount - 1);
+    for (int w = 1; w < threadCount; ++w) {
+        threads_.emplace_back([this, w] { workerLoop(w); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread& t : threads_) {
+        t.join();
+    }
+}
+
+void ThreadPool::workerLoop(int worker) {
+    unsigned long seen = 0;
+    for (;;) {
+        const FunctionRef<void(int)>* task = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+            if (stopping_) {
+                return;
+            }
+            seen = generation_;
+            task = task_;
+        }
+
+        std::exception_ptr error;
+        try {
+            (*task)(worker);
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (error && !error_) {
+                error_ = error;
+            }
+            if (--pending_ == 0) {
+                done_.notify_one();
+            }
+        }
+    }
+}
+
+void ThreadPool::run(FunctionRef<void(int worker)> fn) {
+    if (threads_.empty()) {
+        fn(0);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &fn;
+        pending_ = static_cast<int>(threads_.size());
+        error_ = nullptr;
+        ++generation_;
+    }
+    wake_.notify_all();
+
+    // Çağıran da 0 numaralı işçi olarak çalışır
+    std::exception_ptr error;
+    try {
+        fn(0);
+    } catch (...) {
+        error = std::current_exception();
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [&] { return pending_ == 0; });
+    task_ = nullptr;
+    if (!error) {
+        error = error_;
+    }
+    error_ = nullptr;
+    lock.unlock();
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void ThreadPool::parallelFor(int n, FunctionRef<void(int worker, int begin, int end)> fn) {
+    if (n <= 0) {
+        return;
+    }
+
+    int workers = std::min(size(), n);
+    int chunk = (n + workers - 1) / workers;
+    run([&](int worker) {
+        int begin = worker * chunk;
+        int end = std::min(n, begin + chunk);
+        if (begin < end) {
+            fn(worker, begin, end);
+        }
+    });
+}
@@ -0,0 +1,179 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "BenchmarkLoader.h"
+#include "Heuristics.h"
+#include "LocalSearch.h"
+#include "LowerBounds.h"
+#include "MakespanCalculator.h"
+
+// Standart örnekler üzerinde makespan kalitesi ve süre ölçümü.
+//   benchmark_runner <instance-dir> [--bounds <file>] [--iterations <n>] [--format csv|jsonl]
+// Her örnek için her dağıtım kuralı ve en iyi kuralın çizelgesinden başlayan
+// LocalSearch bir satır üretir; çıktı sürümler arasında diff'lenebilir.
+// lower_bound, bilinen sınır ile hesaplanan sınırın (LowerBounds) büyüğüdür;
+// böylece sınır tablosunda olmayan örnekler için de gap raporlanır.
+
+namespace {
+
+struct Row {
+    std::string instance;
+    int jobs = 0;
+    int machines = 0;
+    std::string solver;
+    int makespan = -1;
+    KnownBounds bounds;
+    double wallMs = 0.0;
+};
+
+// Sınıra göre yüzde fark; sınır bilinmiyorsa boş
+std::string gap(int makespan, int bound) {
+    if (bound <= 0 || makespan < 0) return "";
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.2f", 100.0 * (makespan - bound) / bound);
+    return buf;
+}
+
+std::string fixed(double value) {
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.3f", value);
+    return buf;
+}
+
+void printRow(const Row& r, bool jsonl) {
+    std::string gapLb = gap(r.makespan, r.bounds.lowerBound);
+    std::string gapUb = gap(r.makespan, r.bounds.upperBound);
+    if (jsonl) {
+        auto orNull = [](const std::string& s) { return s.empty() ? std::string("null") : s; };
+        auto boundOrNull = [](int b) { return b < 0 ? std::string("null") : std::to_string(b); };
+        std::cout << "{\"instance\":\"" << r.instance << "\",\"jobs\":" << r.jobs
+                  << ",\"machines\":" << r.machines << ",\"solver\":\"" << r.solver
+                  << "\",\"makespan\":" << r.makespan
+                  << ",\"lower_bound\":" << boundOrNull(r.bounds.lowerBound)
+                  << ",\"upper_bound\":" << boundOrNull(r.bounds.upperBound)
+                  << ",\"gap_lb_pct\":" << orNull(gapLb) << ",\"gap_ub_pct\":" << orNull(gapUb)
+                  << ",\"wall_ms\":" << fixed(r.wallMs) << "}\n";
+    } else {
+        auto bound = [](int b) { return b < 0 ? std::string() : std::to_string(b); };
+        std::cout << r.instance << "," << r.jobs << "," << r.machines << "," << r.solver << ","
+                  << r.makespan << "," << bound(r.bounds.lowerBound) << ","
+                  << bound(r.bounds.upperBound) << "," << gapLb << "," << gapUb << ","
+                  << fixed(r.wallMs) << "\n";
+    }
+}
+
+int usage() {
+    std::cerr << "Usage: benchmark_runner <instance-dir> [--bounds <file>] [--iterations <n>]"
+                 " [--format csv|jsonl]\n";
+    return 2;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) return usage();
+
+    std::string dir = argv[1];
+    std::string boundsFile;
+    int iterations = 1000;
+    bool jsonl = false;
+    for (int a = 2; a < argc; ++a) {
+        std::string arg = argv[a];
+        if (arg == "--bounds" && a + 1 < argc) {
+            boundsFile = argv[++a];
+        } else if (arg == "--iterations" && a + 1 < argc) {
+            iterations = std::stoi(argv[++a]);
+        } else if (arg == "--format" && a + 1 < argc) {
+            std::string format = argv[++a];
+            if (format != "csv" && format != "jsonl") return usage();
+            jsonl = format == "jsonl";
+        } else {
+            return usage();
+        }
+    }
+
+    try {
+        std::unordered_map<std::string, KnownBounds> fileBounds;
+        if (!boundsFile.empty()) fileBounds = BenchmarkLoader::loadBounds(boundsFile);
+
+        // Deterministik sıra: dosya adına göre
+        std::vector<std::filesystem::path> files;
+        for (const auto& entry : std::filesystem::directory_iterator(dir)) {
+            if (entry.is_regular_file()) files.push_back(entry.path());
+        }
+        std::sort(files.begin(), files.end());
+
+        if (!jsonl) {
+            std::cout << "instance,jobs,machines,solver,makespan,lower_bound,upper_bound,"
+                         "gap_lb_pct,gap_ub_pct,wall_ms\n";
+        }
+
+        using Clock = std::chrono::steady_clock;
+        auto msSince = [](Clock::time_point t) {
+            return std::chrono::duration<double, std::milli>(Clock::now() - t).count();
+        };
+
+        for (const auto& file : files) {
+            BenchmarkInstance bench;
+            try {
+                bench = BenchmarkLoader::load(file.string());
+            } catch (const std::exception& e) {
+                std::cerr << "skipping " << file.filename().string() << ": " << e.what() << "\n";
+                continue;
+            }
+
+            // Sınır önceliği: sınır dosyası, Taillard başlığı, yerleşik tablo
+            KnownBounds bounds = bench.bounds;
+            auto it = fileBounds.find(bench.name);
+            if (it != fileBounds.end()) {
+                bounds = it->second;
+            } else if (bounds.lowerBound < 0 && bounds.upperBound < 0) {
+                bounds = BenchmarkLoader::builtinBounds(bench.name);
+            }
+
+            const ProblemInstance& instance = bench.instance;
+            bounds.lowerBound = std::max(bounds.lowerBound, LowerBounds::best(instance));
+            const CompiledInstance& ci = instance.compiled();
+            Row base;
+            base.instance = bench.name;
+            base.jobs = ci.numJobs();
+            base.machines = ci.numMachines();
+            base.bounds = bounds;
+
+            DispatchHeuristics heuristics(instance);
+            Schedule bestSchedule;
+            int bestMakespan = -1;
+            for (DispatchHeuristics::Rule rule : DispatchHeuristics::allRules()) {
+                auto started = Clock::now();
+                Schedule schedule = heuristics.buildSchedule(rule);
+                Row row = base;
+                row.wallMs = msSince(started);
+                row.solver = DispatchHeuristics::ruleName(rule);
+                row.makespan = MakespanCalculator::calculate(schedule);
+                printRow(row, jsonl);
+
+                if (bestMakespan < 0 || row.makespan < bestMakespan) {
+                    bestMakespan = row.makespan;
+                    bestSchedule = std::move(schedule);
+                }
+            }
+
+            LocalSearch localSearch(instance);
+            auto started = Clock::now();
+            auto improved = localSearch.improveSchedule(bestSchedule, iterations);
+            Row row = base;
+            row.wallMs = msSince(started);
+            row.solver = "LocalSearch";
+            row.makespan = improved.second;
+            printRow(row, jsonl);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include "AllocationCounter.h"
+#include "BatchEvaluator.h"
+#include "FeasibilityChecker.h"
+#include "Heuristics.h"
+#include "LocalSearch.h"
+#include "MakespanCalculator.h"
+#include "ScheduleDecoder.h"
+
+// Sıcak yollar için mikro ölçüm: decode, isValid, calculate, her dağıtım kuralı
+// ve bir yerel arama turu; 10x5'ten 1000x50'ye kadar rastgele örneklerde.
+//   microbench [--min-ms <n>] [--filter <substring>] [--max-ops <n>]
+// Her ölçüm en az min-ms süre boyunca tekrarlanır; ns/op, ops/sec ve ölçüm
+// iş parçacığındaki yığın ayırma sayısı (allocs/op) yazdırılır.
+
+namespace {
+
+// Derleyicinin ölçülen çağrıları atmasını engeller
+volatile long long sink = 0;
+
+ProblemInstance randomInstance(int numJobs, int numMachines, unsigned seed) {
+    ProblemInstance instance;
+    std::mt19937 rng(seed);
+    for (int m = 0; m < numMachines; ++m) {
+        std::string mid = "M" + std::to_string(m);
+        instance.machines[mid] = std::make_unique<Machine>(mid);
+    }
+    for (int j = 0; j < numJobs; ++j) {
+        std::string jid = "J" + std::to_string(j);
+        std::vector<int> route(numMachines);
+        std::iota(route.begin(), route.end(), 0);
+        std::shuffle(route.begin(), route.end(), rng);
+
+        std::vector<Operation> ops;
+        for (int k = 0; k < numMachines; ++k) {
+            ops.emplace_back(k, instance.intern("M" + std::to_string(route[k])),
+                             1 + static_cast<int>(rng() % 99));
+        }
+        instance.jobs[jid] = std::make_unique<Job>(jid, std::move(ops));
+    }
+    instance.compile();
+    return instance;
+}
+
+struct Options {
+    double minMs = 200.0;
+    std::string filter;
+    long long maxOps = 50000;
+};
+
+void measure(const Options& options, const std::string& size, const std::string& name,
+             const std::function<long long()>& body, int itemsPerCall = 1) {
+    if (!options.filter.empty() && name.find(options.filter) == std::string::npos) return;
+
+    using Clock = std::chrono::steady_clock;
+    sink = sink + body(); // Isınma
+
+    long long iterations = 0;
+    double elapsedNs = 0.0;
+    AllocationCounter::Scope allocations;
+    auto started = Clock::now();
+    // Saat okumasını ucuz tutmak için artan partiler halinde çalıştır
+    for (long long batch = 1; elapsedNs < options.minMs * 1e6; batch *= 2) {
+        for (long long i = 0; i < batch; ++i) sink = sink + body();
+        iterations += batch;
+        elapsedNs = std::chrono::duration<double, std::nano>(Clock::now() - started).count();
+    }
+
+    // Toplu ölçümlerde ns/op bir öğe (ör. bir aday) başınadır
+    iterations *= itemsPerCall;
+    double nsPerOp = elapsedNs / static_cast<double>(iterations);
+    double allocsPerOp = static_cast<double>(allocations.count()) / static_cast<double>(iterations);
+    std::printf("%-10s %-22s %12lld %16.1f %14.1f %11.2f\n", size.c_str(), name.c_str(),
+                iterations, nsPerOp, 1e9 / nsPerOp, allocsPerOp);
+}
+
+int usage() {
+    std::cerr << "Usage: microbench [--min-ms <n>] [--filter <substring>] [--max-ops <n>]\n";
+    return 2;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int a = 1; a < argc; ++a) {
+        std::string arg = argv[a];
+        if (arg == "--min-ms" && a + 1 < argc) {
+            options.minMs = std::stod(argv[++a]);
+        } else if (arg == "--filter" && a + 1 < argc) {
+            options.filter = argv[++a];
+        } else if (arg == "--max-ops" && a + 1 < argc) {
+            options.maxOps = std::stoll(argv[++a]);
+        } else {
+            return usage();
+        }
+    }
+
+    const std::vector<std::pair<int, int>> sizes = {
+        {10, 5}, {20, 10}, {50, 10}, {100, 20}, {200, 20}, {500, 20}, {1000, 50}};
+
+    std::printf("%-10s %-22s %12s %16s %14s %11s\n", "size", "benchmark", "iterations", "ns/op",
+                "ops/sec", "allocs/op");
+    for (auto [jobs, machines] : sizes) {
+        if (static_cast<long long>(jobs) * machines > options.maxOps) continue;
+        const std::string size = std::to_string(jobs) + "x" + std::to_string(machines);
+
+        ProblemInstance instance = randomInstance(jobs, machines, 12345u + jobs * 31u + machines);
+        DispatchHeuristics heuristics(instance);
+        const Schedule base = heuristics.buildSchedule(DispatchHeuristics::Rule::MWKR);
+        Schedule schedule = base;
+
+        measure(options, size, "decode", [&]() {
+            return static_cast<long long>(ScheduleDecoder::decode(schedule, instance));
+        });
+        measure(options, size, "isValid", [&]() {
+            return static_cast<long long>(FeasibilityChecker::isValid(schedule, instance));
+        });
+        measure(options, size, "calculate", [&]() {
+            return static_cast<long long>(MakespanCalculator::calculate(schedule));
+        });
+        // 64 aday: makine sıraları aynı, sadece makespan (decode ile karşılaştırma için)
+        BatchEvaluator batch(instance);
+        std::vector<int> candidates;
+        for (int c = 0; c < 64; ++c) {
+            candidates.insert(candidates.end(), base.sequence.begin(), base.sequence.end());
+        }
+        std::vector<int> makespans(64);
+        measure(options, size, "batchEvaluate", [&]() {
+            batch.evaluate(candidates.data(), 64, makespans.data());
+            return static_cast<long long>(makespans[63]);
+        }, 64);
+        BatchEvaluator parallelBatch(instance);
+        parallelBatch.setThreadCount(0);
+        measure(options, size, "batchEvaluate/threads", [&]() {
+            parallelBatch.evaluate(candidates.data(), 64, makespans.data());
+            return static_cast<long long>(makespans[63]);
+        }, 64);
+        for (DispatchHeuristics::Rule rule : DispatchHeuristics::allRules()) {
+            measure(options, size, std::string("dispatch/") + DispatchHeuristics::ruleName(rule), [&]() {
+                return static_cast<long long>(heuristics.buildSchedule(rule).makespan);
+            });
+        }
+        // findBestSwap özeldir; tek iterasyonlu improveSchedule bir tur arama + kabul demektir
+        LocalSearch localSearch(instance);
+        measure(options, size, "localSearch/round", [&]() {
+            return static_cast<long long>(localSearch.improveSchedule(base, 1).second);
+        });
+    }
+    return 0;
+}
@@ -1,11 +1,25 @@
 #include <iostream>
 #include <cassert>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <filesystem>
+#include <fstream>
 #include "Heuristics.h"
 #include "LocalSearch.h"
+#include "PortfolioSolver.h"
+#include "TabuSearch.h"
+#include "GeneticAlgorithm.h"
+#include "SimulatedAnnealing.h"
+#include "AnytimeSolver.h"
+#include <thread>
+#include "BenchmarkLoader.h"
+#include "AllocationCounter.h"
 #include "InputParser.h"
 #include "ScheduleDecoder.h"
 #include "MakespanCalculator.h"
 #include "FeasibilityChecker.h"
+#include "ScheduleHash.h"
 
 // Basit bir test örneği oluştur
 ProblemInstance createTestInstance() {
@@ -18,28 +32,55 @@ ProblemInstance createTestInstance() {
 
     // Job1: M1(10) -> M2(5) -> M3(8) - toplam 23
     std::vector<Operation> job1Ops;
-    job1Ops.emplace_back("J1", 0, "M1", 10);
-    job1Ops.emplace_back("J1", 1, "M2", 5);
-    job1Ops.emplace_back("J1", 2, "M3", 8);
+    job1Ops.emplace_back(0, instance.intern("M1"), 10);
+    job1Ops.emplace_back(1, instance.intern("M2"), 5);
+    job1Ops.emplace_back(2, instance.intern("M3"), 8);
     instance.jobs["J1"] = std::make_unique<Job>("J1", std::move(job1Ops));
 
     // Job2: M2(3) -> M1(7) -> M3(4) - toplam 14
     std::vector<Operation> job2Ops;
-    job2Ops.emplace_back("J2", 0, "M2", 3);
-    job2Ops.emplace_back("J2", 1, "M1", 7);
-    job2Ops.emplace_back("J2", 2, "M3", 4);
+    job2Ops.emplace_back(0, instance.intern("M2"), 3);
+    job2Ops.emplace_back(1, instance.intern("M1"), 7);
+    job2Ops.emplace_back(2, instance.intern("M3"), 4);
     instance.jobs["J2"] = std::make_unique<Job>("J2", std::move(job2Ops));
 
     // Job3: M3(2) -> M2(6) -> M1(9) - toplam 17
     std::vector<Operation> job3Ops;
-    job3Ops.emplace_back("J3", 0, "M3", 2);
-    job3Ops.emplace_back("J3", 1, "M2", 6);
-    job3Ops.emplace_back("J3", 2, "M1", 9);
+    job3Ops.emplace_back(0, instance.intern("M3"), 2);
+    job3Ops.emplace_back(1, instance.intern("M2"), 6);
+    job3Ops.emplace_back(2, instance.intern("M1"), 9);
     instance.jobs["J3"] = std::make_unique<Job>("J3", std::move(job3Ops));
 
     return instance;
 }
 
+// Rastgele (ama tekrarlanabilir) bir jobs x machines örneği
+ProblemInstance createRandomInstance(int numJobs, int numMachines, unsigned seed) {
+    ProblemInstance instance;
+    std::mt19937 rng(seed);
+
+    for (int m = 0; m < numMachines; ++m) {
+        std::string mid = "M" + std::to_string(m);
+        instance.machines[mid] = std::make_unique<Machine>(mid);
+    }
+
+    for (int j = 0; j < numJobs; ++j) {
+        std::string jid = "J" + std::to_string(j);
+        std::vector<int> route(numMachines);
+        std::iota(route.begin(), route.end(), 0);
+        std::shuffle(route.begin(), route.end(), rng);
+
+        std::vector<Operation> ops;
+        for (int k = 0; k < numMachines; ++k) {
+            int duration = 1 + static_cast<int>(rng() % 50);
+            ops.emplace_back(k, instance.intern("M" + std::to_string(route[k])), duration);
+        }
+        instance.jobs[jid] = std::make_unique<Job>(jid, std::move(ops));
+    }
+
+    return instance;
+}
+
 void testSPT() {
     std::cout << "Test 1: SPT (Shortest Processing Time) Heuristic\n";
     ProblemInstance instance = createTestInstance();
@@ -139,8 +180,170 @@ void testLocalSearch() {
     std::cout << "  ✓ Passed\n\n";
 }
 
+void testLocalSearchEstimateMode() {
+    std::cout << "Test 5: Local Search with Head/Tail Estimates\n";
+    ProblemInstance instance = createTestInstance();
+    
+    DispatchHeuristics heuristics(instance);
+    Schedule initialSchedule = heuristics.buildSPTSchedule();
+    int initialMakespan = MakespanCalculator::calculate(initialSchedule);
+    
+    LocalSearch fullSearch(instance);
+    auto [fullSchedule, fullMakespan] = fullSearch.improveSchedule(initialSchedule, 50);
+    
+    // Tahmin modu: sadece umut verici adaylar çözülür
+    LocalSearch estimateSearch(instance);
+    estimateSearch.setEvaluationMode(LocalSearch::EvaluationMode::HeadTailEstimate, 2);
+    auto [estSchedule, estMakespan] = estimateSearch.improveSchedule(initialSchedule, 50);
+    
+    std::cout << "  Incremental: " << fullMakespan << ", Estimate: " << estMakespan << "\n";
+    
+    bool feasible = FeasibilityChecker::isValid(estSchedule, instance);
+    assert(feasible && "Estimate-mode schedule should be feasible");
+    assert(estMakespan <= initialMakespan && "Makespan should not worsen");
+    
+    std::cout << "  ✓ Passed\n\n";
+}
+
+void testParallelLocalSearch() {
+    std::cout << "Test 6: Parallel Local Search Determinism\n";
+    ProblemInstance instance = createRandomInstance(15, 6, 21);
+    
+    DispatchHeuristics heuristics(instance);
+    Schedule initialSchedule = heuristics.buildSPTSchedule();
+    
+    LocalSearch serial(instance);
+    auto [serialSchedule, serialMakespan] = serial.improveSchedule(initialSchedule, 200);
+    
+    // Aynı başlangıçtan paralel arama aynı sonucu vermeli
+    LocalSearch parallel(instance);
+    parallel.setThreadCount(4);
+    assert(parallel.threadCount() == 4);
+    auto [parallelSchedule, parallelMakespan] = parallel.improveSchedule(initialSchedule, 200);
+    
+    std::cout << "  Initial: " << MakespanCalculator::calculate(initialSchedule)
+              << ", Serial: " << serialMakespan << ", Parallel: " << parallelMakespan << "\n";
+    
+    assert(parallelMakespan == serialMakespan && "Parallel search should match serial search");
+    assert(parallelSchedule.sequence == serialSchedule.sequence && "Same moves should be chosen");
+    assert(FeasibilityChecker::isValid(parallelSchedule, instance));
+    
+    std::cout << "  ✓ Passed\n\n";
+}
+
+// Aktif çizelge: hiçbir işlem, makinesindeki daha önceki bir boşluğa
+// başka bir işlemi geciktirmeden sola kaydırılamaz
+bool isActive(const Schedule& schedule, const ProblemInstance& instance) {
+    const CompiledInstance& ci = instance.compiled();
+    for (int m = 0; m < schedule.numMachines(); ++m) {
+        for (int p = schedule.machineBegin(m); p < schedule.machineEnd(m); ++p) {
+            int op = schedule.sequence[p];
+            int jobReady = ci.opIndexOf(op) > 0 ? schedule.endTime[op - 1] : 0;
+
+            int gapStart = 0;
+            for (int q = schedule.machineBegin(m); q < p; ++q) {
+                int gapEnd = schedule.startTime[schedule.sequence[q]];
+                if (std::max(gapStart, jobReady) + ci.opDuration[op] <= gapEnd) {
+                    return false;
+                }
+                gapStart = schedule.endTime[schedule.sequence[q]];
+            }
+        }
+    }
+    return true;
+}
+
+// Örnek kullanıcı kuralı: en erken başlayabilen, eşitlikte en uzun kalan iş
+struct EarliestStartMWKR {
+    long long key(const DispatchContext& ctx, int op) const {
+        return static_cast<long long>(ctx.earliestStart(op)) * 1000000 - ctx.ci.remainingWork[op];
+    }
+};
+
+void testActiveSchedules() {
+    std::cout << "Test 7: Giffler-Thompson Active Schedules (All Rules)\n";
+    ProblemInstance instance = createRandomInstance(20, 8, 99);
+    DispatchHeuristics heuristics(instance);
+    
+    auto check = [&](const Schedule& s, const char* name) {
+        assert(FeasibilityChecker::isValid(s, instance) && "Dispatch schedule should be feasible");
+        assert(static_cast<int>(s.sequence.size()) == instance.compiled().numOps());
+        assert(isActive(s, instance) && "Dispatch schedule should be active");
+        std::cout << "  " << name << ": " << s.makespan << "\n";
+    };
+    
+    for (DispatchHeuristics::Rule rule : DispatchHeuristics::allRules()) {
+        check(heuristics.buildSchedule(rule), DispatchHeuristics::ruleName(rule));
+    }
+    check(heuristics.buildSchedule(CompositeRule{1.0, 0.0, 2.0, 0.0}), "SPT+MOR");
+    check(heuristics.buildSchedule<EarliestStartMWKR>(), "Custom");
+    
+    // Kural ile sarmalayıcı aynı çizelgeyi üretmeli
+    assert(heuristics.buildSchedule(DispatchHeuristics::Rule::SPT).sequence ==
+           heuristics.buildSPTSchedule().sequence);
+    
+    std::cout << "  ✓ Passed\n\n";
+}
+
+void testPortfolioSolver() {
+    std::cout << "Test 8: Parallel Portfolio Solver\n";
+    ProblemInstance instance = createRandomInstance(15, 5, 8);
+    
+    PortfolioOptions options;
+    options.threads = 4;
+    options.maxIterations = 200;
+    PortfolioResult result = PortfolioSolver(instance).solve(options);
+    
+    assert(result.strategies.size() == DispatchHeuristics::allRules().size());
+    assert(FeasibilityChecker::isValid(result.best, instance) && "Portfolio best should be feasible");
+    assert(MakespanCalculator::calculate(result.best) == result.bestMakespan);
+    
+    for (const StrategyResult& r : result.strategies) {
+        std::cout << "  " << r.name << ": " << r.initialMakespan << " -> " << r.makespan
+                  << " (" << r.iterations << " it" << (r.cutOff ? ", cut" : "") << ")\n";
+        assert(r.makespan >= result.bestMakespan && "Best should be the minimum over strategies");
+        assert(r.makespan <= r.initialMakespan && "Local search should not worsen");
+    }
+    std::cout << "  Best: " << result.bestStrategy << " = " << result.bestMakespan << "\n";
+    
+    std::cout << "  ✓ Passed\n\n";
+}
+
+void testTabuSearch() {
+    std::cout << "Test 9: Tabu Search on Critical Blocks\n";
+    ProblemInstance instance = createRandomInstance(10, 5, 4);
+    DispatchHeuristics heuristics(instance);
+    Schedule initial = heuristics.buildSPTSchedule();
+    
+    LocalSearch localSearch(instance);
+    int descentMakespan = localSearch.improveSchedule(initial, 1000).second;
+    
+    TabuSearch tabu(instance);
+    for (TabuNeighborhood neighborhood : {TabuNeighborhood::N5, TabuNeighborhood::N6}) {
+        TabuOptions options;
+        options.neighborhood = neighborhood;
+        options.maxIterations = 3000;
+        options.maxStagnation = 500;
+        TabuResult result = tabu.run(initial, options);
+        
+        std::cout << "  " << (neighborhood == TabuNeighborhood::N5 ? "N5" : "N6") << ": "
+                  << result.initialMakespan << " -> " << result.bestMakespan
+                  << " (" << result.iterations << " it, " << result.restarts << " restarts)\n";
+        assert(FeasibilityChecker::isValid(result.best, instance) && "Tabu best should be feasible");
+        assert(MakespanCalculator::calculate(result.best) == result.bestMakespan);
+        assert(result.bestMakespan <= descentMakespan && "Tabu should match or beat steepest descent");
+        
+        // Aynı seed ile deterministik
+        TabuResult again = tabu.run(initial, options);
+        assert(again.bestMakespan == result.bestMakespan && again.iterations == result.iterations);
+    }
+    std::cout << "  Steepest descent: " << descentMakespan << "\n";
+    
+    std::cout << "  ✓ Passed\n\n";
+}
+
 void testAllHeuristicsComparison() {
-    std::cout << "Test 5: Compare All Heuristics\n";
+    std::cout << "Test 10: Compare All Heuristics\n";
     ProblemInstance instance = createTestInstance();
     
     DispatchHeuristics heuristics(instance);
@@ -170,6 +373,496 @@ void testAllHeuristicsComparison() {
     std::cout << "  ✓ Passed\n\n";
 }
 
+// JSON metnini geçici bir dosyaya yazıp ayrıştırır; hata mesajını döndürür ("" = başarılı)
+std::string parseJsonText(const std::string& text, ProblemInstance* out = nullptr) {
+    std::string path = (std::filesystem::temp_directory_path() / "jssp_parser_test.json").string();
+    {
+        std::ofstream file(path);
+        file << text;
+    }
+    try {
+        ProblemInstance instance = InputParser::parseFromJsonFile(path);
+        if (out) *out = std::move(instance);
+        return "";
+    } catch (const std::runtime_error& e) {
+        return e.what();
+    }
+}
+
+void testStreamingParser() {
+    std::cout << "Test 11: Streaming JSON Parser\n";
+    
+    // Anahtar sırası serbesttir: jobs önce, id operations'tan sonra, bilinmeyen alanlar atlanır
+    ProblemInstance instance;
+    std::string error = parseJsonText(R"({
+        "jobs": [
+            {"operations": [{"duration": 3, "machine": "M1", "note": {"x": [1, 2]}},
+                            {"machine": "M2", "duration": 2}], "id": "J1"},
+            {"id": "J2", "extra": [[]], "operations": [{"machine": "M2", "duration": 4}]}
+        ],
+        "meta": {"source": [1, {"a": null}]},
+        "machines": ["M1", "M2"]
+    })", &instance);
+    assert(error.empty() && "Valid input should parse");
+    assert(instance.jobs.size() == 2 && instance.machines.size() == 2);
+    assert(instance.compiled().numOps() == 3);
+    assert(instance.jobs.at("J1")->operations()[0].duration() == 3);
+    
+    // DOM ayrıştırıcısı ile aynı require() mesajları
+    auto expectError = [](const std::string& text, const std::string& message) {
+        std::string got = parseJsonText(text);
+        if (got != "Input error: " + message) {
+            std::cerr << "  expected '" << message << "', got '" << got << "'\n";
+            assert(false && "Parser error message mismatch");
+        }
+    };
+    expectError(R"([1, 2])", "root must be a JSON object");
+    expectError(R"({"jobs": []})", "`machines` must be an array");
+    expectError(R"({"machines": []})", "`jobs` must be an array");
+    expectError(R"({"machines": [], "jobs": []})", "machines list cannot be empty");
+    expectError(R"({"machines": [{"id": 1}], "jobs": []})", "each machine id must be a string");
+    expectError(R"({"machines": ["M", "M"], "jobs": []})", "duplicate machine id: M");
+    expectError(R"({"machines": ["M"], "jobs": [5]})", "each job must be an object");
+    expectError(R"({"machines": ["M"], "jobs": [{"operations": []}]})", "job missing string `id`");
+    expectError(R"({"machines": ["M"], "jobs": [{"id": "J"}]})", "job J missing `operations` array");
+    expectError(R"({"machines": ["M"], "jobs": [{"id": "J", "operations": [{"machine": "M"}]}]})",
+                "job J op 0 missing int `duration`");
+    expectError(R"({"machines": ["M"], "jobs": [{"id": "J", "operations": [{"machine": "M", "duration": 1.5}]}]})",
+                "job J op 0 missing int `duration`");
+    expectError(R"({"jobs": [{"id": "J", "operations": [{"machine": "X", "duration": 1}]}], "machines": ["M"]})",
+                "unknown machine X in job J op 0");
+    expectError(R"({"machines": ["M"], "jobs": [{"id": "J", "operations": [{"machine": "M", "duration": 0}]}]})",
+                "duration must be > 0 in job J op 0");
+    expectError(R"({"machines": ["M"], "jobs": []})", "jobs list cannot be empty");
+    
+    std::cout << "  ✓ Passed\n\n";
+}
+
+void testBenchmarkLoader() {
+    std::cout << "Test 12: OR-Library and Taillard Loaders\n";
+    
+    namespace fs = std::filesystem;
+    fs::path dir = fs::temp_directory_path() / "jssp_benchmark_test";
+    fs::create_directories(dir);
+    auto writeFile = [&](const std::string& name, const std::string& text) {
+        std::ofstream((dir / name).string()) << text;
+        return (dir / name).string();
+    };
+    
+    // ft06 (OR-Library biçimi, açıklama satırlarıyla)
+    std::string ft06 = writeFile("ft06.txt",
+        " instance ft06\n"
+        " Fisher and Thompson 6x6 instance, alternate name (mt06)\n"
+        " 6 6\n"
+        " 2  1  0  3  1  6  3  7  5  3  4  6\n"
+        " 1  8  2  5  4 10  5 10  0 10  3  4\n"
+        " 2  5  3  4  5  8  0  9  1  1  4  7\n"
+        " 1  5  0  5  2  5  3  3  4  8  5  9\n"
+        " 2  9  1  3  4  5  5  4  0  3  3  1\n"
+        " 1  3  3  3  5  9  0 10  4  4  2  1\n");
+    BenchmarkInstance ft = BenchmarkLoader::load(ft06);
+    assert(ft.name == "ft06");
+    assert(ft.instance.compiled().numJobs() == 6 && ft.instance.compiled().numMachines() == 6);
+    assert(ft.instance.compiled().numOps() == 36);
+    const Operation& first = ft.instance.jobs.at("J0")->operations()[0];
+    assert(ft.instance.machineName(first) == "M2" && first.duration() == 1);
+    
+    KnownBounds ftBounds = BenchmarkLoader::builtinBounds(ft.name);
+    assert(ftBounds.lowerBound == 55 && ftBounds.upperBound == 55);
+    DispatchHeuristics heuristics(ft.instance);
+    int makespan = MakespanCalculator::calculate(heuristics.buildSchedule(DispatchHeuristics::Rule::SPT));
+    assert(makespan >= ftBounds.lowerBound && "No schedule can beat the proven optimum");
+    
+    // Taillard biçimi: başlıkta sınırlar, makineler 1 tabanlı
+    std::string ta = writeFile("ta_small.txt",
+        "Nb of jobs, Nb of Machines, Time seed, Machine seed, Upper bound, Lower bound\n"
+        "          2           3    840612802    398197754         14         11\n"
+        "Times\n"
+        " 4  3  2\n"
+        " 1  5  6\n"
+        "Machines\n"
+        " 1  2  3\n"
+        " 3  1  2\n");
+    BenchmarkInstance tai = BenchmarkLoader::load(ta);
+    assert(tai.bounds.upperBound == 14 && tai.bounds.lowerBound == 11);
+    assert(tai.instance.compiled().numOps() == 6);
+    assert(tai.instance.machineName(tai.instance.jobs.at("J1")->operations()[0]) == "M2");
+    assert(tai.instance.jobs.at("J1")->operations()[2].duration() == 6);
+    
+    // Sınır dosyası: "ad alt üst" veya "ad optimal"
+    std::string boundsFile = writeFile("bounds.txt", "# name lb ub\nta01 1231\nta21 1642 1644\n");
+    auto bounds = BenchmarkLoader::loadBounds(boundsFile);
+    assert(bounds.size() == 2);
+    assert(bounds.at("ta01").lowerBound == 1231 && bounds.at("ta01").upperBound == 1231);
+    assert(bounds.at("ta21").lowerBound == 1642 && bounds.at("ta21").upperBound == 1644);
+    
+    // Eksik işlem satırları hata verir
+    std::string truncated = writeFile("broken.txt", "2 2\n0 3 1 2\n");
+    bool threw = false;
+    try {
+        BenchmarkLoader::load(truncated);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw && "Truncated instance should be rejected");
+    
+    fs::remove_all(dir);
+    std::cout << "  ✓ Passed\n\n";
+}
+
+void testGeneticAlgorithm() {
+    std::cout << "Test 13: Genetic Algorithm (POX/JOX, memetic)\n";
+    
+    ProblemInstance instance = createRandomInstance(15, 6, 17);
+    GeneticAlgorithm ga(instance);
+    const CompiledInstance& ci = instance.compiled();
+    
+    // Her kromozom (tekrarlı permütasyon) uygulanabilir bir aktif çizelgeye çözülür;
+    // aktif bir çizelgenin kodu aynı makespan'a çözülür
+    std::vector<int> chromosome;
+    for (int j = 0; j < ci.numJobs(); ++j) chromosome.insert(chromosome.end(), ci.jobLength(j), j);
+    std::mt19937 rng(3);
+    for (int trial = 0; trial < 20; ++trial) {
+        std::shuffle(chromosome.begin(), chromosome.end(), rng);
+        Schedule schedule = ga.decode(chromosome);
+        assert(FeasibilityChecker::isValid(schedule, instance));
+        Schedule again = ga.decode(ga.encode(schedule));
+        assert(again.makespan == schedule.makespan);
+    }
+    
+    DispatchHeuristics heuristics(instance);
+    int bestRule = INT_MAX;
+    for (DispatchHeuristics::Rule rule : DispatchHeuristics::allRules()) {
+        bestRule = std::min(bestRule, heuristics.buildSchedule(rule).makespan);
+    }
+    
+    GeneticOptions options;
+    options.populationSize = 30;
+    options.generations = 40;
+    options.threads = 1;
+    for (GeneticCrossover crossover : {GeneticCrossover::POX, GeneticCrossover::JOX}) {
+        options.crossover = crossover;
+        GeneticResult serial = ga.run(options);
+        assert(serial.bestMakespan > 0 && serial.bestMakespan <= bestRule &&
+               "Rule-seeded GA with elitism cannot be worse than the rules");
+        assert(FeasibilityChecker::isValid(serial.best, instance));
+        assert(serial.best.makespan == serial.bestMakespan);
+        // Alt sınıra ulaşılırsa nesil sınırından önce durur
+        assert(serial.generations == 40 || serial.bestMakespan == serial.lowerBound);
+        assert(serial.evaluations == 30 + serial.generations * 28);
+        
+        // Paralel uygunluk değerlendirmesi sonucu değiştirmez
+        GeneticOptions parallel = options;
+        parallel.threads = 3;
+        assert(ga.run(parallel).bestMakespan == serial.bestMakespan);
+        
+        std::cout << "  " << (crossover == GeneticCrossover::POX ? "POX" : "JOX")
+                  << ": " << serial.bestMakespan << " (best rule " << bestRule << ")\n";
+    }
+    
+    options.crossover = GeneticCrossover::POX;
+    options.memetic = true;
+    options.generations = 10;
+    GeneticResult memetic = ga.run(options);
+    assert(FeasibilityChecker::isValid(memetic.best, instance));
+    assert(MakespanCalculator::calculate(memetic.best) == memetic.bestMakespan);
+    std::cout << "  Memetic: " << memetic.bestMakespan << "\n";
+
+    // İşçi başına tekrar kullanılan yerel aramalar sonucu değiştirmez
+    GeneticOptions parallelMemetic = options;
+    parallelMemetic.threads = 3;
+    assert(ga.run(parallelMemetic).bestMakespan == memetic.bestMakespan);
+    
+    std::cout << "  ✓ Passed\n\n";
+}
+
+void testSimulatedAnnealing() {
+    std::cout << "Test 14: Simulated Annealing with Time Budget\n";
+    
+    ProblemInstance instance = createRandomInstance(20, 8, 29);
+    DispatchHeuristics heuristics(instance);
+    Schedule initial = heuristics.buildSPTSchedule();
+    int initialMakespan = MakespanCalculator::calculate(initial);
+    SimulatedAnnealing annealer(instance);
+    
+    // Her soğutma planı: en iyi çizelge geçerli ve başlangıçtan kötü değil; aynı seed aynı sonuç
+    for (CoolingSchedule cooling : {CoolingSchedule::Geometric, CoolingSchedule::LundyMees,
+                                    CoolingSchedule::TimeBased}) {
+        AnnealingOptions options;
+        options.cooling = cooling;
+        options.timeLimitSeconds = 0.0;
+        options.maxIterations = 20000;
+        options.reheatAfter = 3000;
+        AnnealingResult result = annealer.run(initial, options);
+        assert(result.initialMakespan == initialMakespan);
+        assert(result.bestMakespan > 0 && result.bestMakespan <= initialMakespan);
+        assert(FeasibilityChecker::isValid(result.best, instance));
+        assert(MakespanCalculator::calculate(result.best) == result.bestMakespan);
+        assert(!result.timedOut && result.accepted > 0);
+        assert(annealer.run(initial, options).bestMakespan == result.bestMakespan);
+        std::cout << "  cooling " << static_cast<int>(cooling) << ": " << initialMakespan
+                  << " -> " << result.bestMakespan << " (" << result.reheats << " reheats)\n";
+    }
+    
+    // Kesin süre bütçesi: iterasyon sınırı olmadan bütçe dolunca en iyi çizelge döner
+    AnnealingOptions timed;
+    timed.timeLimitSeconds = 0.05;
+    AnnealingResult result = annealer.run(initial, timed);
+    assert(result.timedOut);
+    assert(result.wallSeconds < 0.5);
+    assert(FeasibilityChecker::isValid(result.best, instance));
+    assert(result.bestMakespan <= initialMakespan);
+    
+    std::cout << "  ✓ Passed\n\n";
+}
+
+void testAnytimeSolver() {
+    std::cout << "Test 15: Anytime Solver (deadline, cancellation, best-so-far slot)\n";
+    
+    ProblemInstance instance = createRandomInstance(15, 15, 31);
+    AnytimeSolver solver(instance);
+    
+    // Son tarih: iyileşmeler kesin azalan sırayla yayımlanır, slot son değeri tutar
+    BestSolutionSlot slot;
+    std::vector<int> published;
+    AnytimeOptions options;
+    options.timeLimitSeconds = 0.3;
+    options.slot = &slot;
+    options.onImprovement = [&](const AnytimeUpdate& update) {
+        assert(FeasibilityChecker::isValid(update.schedule, instance));
+        published.push_back(update.makespan);
+    };
+    AnytimeResult result = solver.solve(options);
+    assert(result.stop == AnytimeStop::Deadline);
+    assert(result.firstSolutionSeconds >= 0.0 && result.firstSolutionSeconds < 0.1);
+    assert(result.wallSeconds < 1.0);
+    assert(FeasibilityChecker::isValid(result.best, instance));
+    assert(MakespanCalculator::calculate(result.best) == result.bestMakespan);
+    assert(static_cast<int>(published.size()) == result.improvements);
+    for (size_t i = 1; i < published.size(); ++i) assert(published[i] < published[i - 1]);
+    assert(published.back() == result.bestMakespan);
+    assert(slot.makespan() == result.bestMakespan && static_cast<int>(slot.version()) == result.improvements);
+    assert(slot.load()->makespan == result.bestMakespan);
+    unsigned seen = 0;
+    assert(slot.loadIfNewer(seen)->makespan == result.bestMakespan && seen == slot.version());
+    assert(slot.loadIfNewer(seen) == nullptr && "Unchanged slot returns nothing");
+    std::cout << "  Deadline: " << published.front() << " -> " << result.bestMakespan << " ("
+              << result.improvements << " improvements, source " << result.bestSource << ")\n";
+    
+    // İptal: son tarih yok, arka planda çalışır, operatör onaylayınca temiz durur
+    for (AnytimeEngine engine : {AnytimeEngine::Tabu, AnytimeEngine::Annealing}) {
+        BestSolutionSlot background;
+        AnytimeOptions async;
+        async.timeLimitSeconds = 0.0;
+        async.engine = engine;
+        async.slot = &background;
+        CancellationToken commit = async.cancel;
+        std::future<AnytimeResult> pending = solver.solveAsync(async);
+        while (background.makespan() < 0) std::this_thread::yield();
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        commit.cancel();
+        AnytimeResult cancelled = pending.get();
+        assert(cancelled.stop == AnytimeStop::Cancelled);
+        assert(FeasibilityChecker::isValid(cancelled.best, instance));
+        assert(cancelled.bestMakespan == background.makespan());
+    }
+    
+    // Hedef: ilk kuralın makespan'ı hedefse kural aşamasında durur
+    AnytimeOptions target;
+    target.targetMakespan = 1 << 30;
+    AnytimeResult reached = solver.solve(target);
+    assert(reached.stop == AnytimeStop::TargetReached && reached.improvements == 1);
+    
+    std::cout << "  ✓ Passed\n\n";
+}
+
+void testLowerBounds() {
+    std::cout << "Test 16: Lower Bounds, Early Stop and Gap\n";
+    
+    // Küçük örnek: en uzun iş 23, M1 yükü 26; Jackson sınırı yüke eşit
+    ProblemInstance small = createTestInstance();
+    LowerBoundReport report = LowerBounds::compute(small);
+    assert(report.jobLength == 23 && report.machineLoad == 26);
+    assert(report.oneMachine == 26 && report.best() == 26);
+    assert(small.compiled().machineIds[report.oneMachineMachine] == "M1");
+    
+    // Sınır her bulunan çizelgenin altında; tek makine sınırı yükten zayıf değil
+    for (unsigned seed : {3u, 5u, 8u}) {
+        ProblemInstance instance = createRandomInstance(10, 10, seed);
+        LowerBoundReport bounds = LowerBounds::compute(instance);
+        assert(bounds.oneMachine >= bounds.machineLoad);
+        
+        DispatchHeuristics heuristics(instance);
+        TabuOptions options;
+        options.maxIterations = 2000;
+        TabuResult result = TabuSearch(instance).run(heuristics.buildSPTSchedule(), options);
+        assert(result.lowerBound == bounds.best());
+        assert(result.bestMakespan >= result.lowerBound && "No schedule can beat a lower bound");
+        assert(result.gapPercent() >= 0.0);
+    }
+    
+    // Makine sınırlı örnek: arama alt sınırda durur, fark sıfırdır
+    ProblemInstance machineBound = createRandomInstance(30, 5, 31);
+    Schedule initial = DispatchHeuristics(machineBound).buildSPTSchedule();
+    TabuOptions tabu;
+    tabu.maxIterations = 1000000;
+    TabuResult optimal = TabuSearch(machineBound).run(initial, tabu);
+    std::cout << "  Tabu: " << optimal.bestMakespan << " (lb " << optimal.lowerBound << ", "
+              << optimal.iterations << " it)\n";
+    assert(optimal.bestMakespan == optimal.lowerBound && optimal.gapPercent() == 0.0);
+    assert(optimal.iterations < tabu.maxIterations && "Search should stop at the lower bound");
+    
+    LocalSearch search(machineBound);
+    auto [improved, makespan] = search.improveSchedule(initial, 1000000);
+    assert(makespan >= search.lowerBound());
+    
+    AnytimeOptions anytime;
+    anytime.timeLimitSeconds = 10.0;
+    AnytimeResult proven = AnytimeSolver(machineBound).solve(anytime);
+    assert(proven.stop == AnytimeStop::LowerBoundReached && proven.gapPercent() == 0.0);
+    
+    assert(LowerBounds::gapPercent(110, 100) == 10.0 && LowerBounds::gapPercent(-1, 100) < 0.0);
+    
+    std::cout << "  ✓ Passed\n\n";
+}
+
+void testEvaluationCache() {
+    std::cout << "Test 17: Evaluation Cache in Local Search and Metaheuristics\n";
+    ProblemInstance instance = createRandomInstance(15, 10, 41);
+    Schedule initial = DispatchHeuristics(instance).buildSPTSchedule();
+    
+    // Önbellek sonucu değiştirmez, sadece çözmeleri atlar
+    LocalSearch plain(instance);
+    LocalSearch cached(instance);
+    auto cache = std::make_shared<EvaluationCache>(1 << 16);
+    cached.setEvaluationCache(cache);
+    int descent = plain.improveSchedule(initial, 1000).second;
+    assert(cached.improveSchedule(initial, 1000).second == descent);
+    EvaluationCacheStats local = cache->stats();
+    std::cout << "  LocalSearch: " << local.hits << "/" << local.lookups << " hits\n";
+    assert(local.hits > 0 && "Swapping back the last move should hit the cache");
+    
+    TabuOptions tabu;
+    tabu.maxIterations = 3000;
+    TabuResult tabuPlain = TabuSearch(instance).run(initial, tabu);
+    tabu.cache = std::make_shared<EvaluationCache>(1 << 16);
+    TabuResult tabuCached = TabuSearch(instance).run(initial, tabu);
+    assert(tabuCached.bestMakespan == tabuPlain.bestMakespan);
+    assert(tabuCached.iterations == tabuPlain.iterations);
+    assert(tabuCached.decodes + tabuCached.cacheHits == tabuPlain.decodes);
+    assert(tabuPlain.cacheHits == 0 && tabuCached.cacheHits > 0);
+    std::cout << "  Tabu: " << tabuCached.cacheHits << " decodes saved ("
+              << static_cast<int>(100 * tabuCached.cacheHitRate()) << "% hit rate)\n";
+    
+    AnnealingOptions annealing;
+    annealing.timeLimitSeconds = 0.0;
+    annealing.maxIterations = 20000;
+    AnnealingResult annealPlain = SimulatedAnnealing(instance).run(initial, annealing);
+    annealing.cache = std::make_shared<EvaluationCache>(1 << 16);
+    AnnealingResult annealCached = SimulatedAnnealing(instance).run(initial, annealing);
+    assert(annealCached.bestMakespan == annealPlain.bestMakespan);
+    assert(annealCached.accepted == annealPlain.accepted);
+    assert(annealCached.cacheHits > 0);
+    assert(FeasibilityChecker::isValid(annealCached.best, instance));
+    std::cout << "  Annealing: " << annealCached.cacheHits << " decodes saved ("
+              << static_cast<int>(100 * annealCached.cacheHitRate()) << "% hit rate)\n";
+    
+    // Özet çakışması: makespan'ı kötüleştiren komşulara sahte (çok iyi) değerler
+    // yazılmış önbellek. İsabetler kabul anında doğrulanır; sahte kayıtlar
+    // düzeltilir, kötü hamle kabul edilmez
+    auto poisoned = [&]() {
+        auto poison = std::make_shared<EvaluationCache>(1 << 16);
+        std::uint64_t hash = ScheduleHash::compute(initial);
+        Schedule probe = initial;
+        MoveJournal journal;
+        for (int m = 0; m < initial.numMachines(); ++m) {
+            for (int p = initial.machineBegin(m); p + 1 < initial.machineEnd(m); ++p) {
+                SwapMove move(p);
+                if (move.apply(probe, instance, journal)) {
+                    int makespan = probe.makespan;
+                    move.undo(probe, journal);
+                    if (makespan <= initial.makespan) continue;
+                }
+                poison->insert(move.hashAfter(initial, hash), 1);
+            }
+        }
+        return poison;
+    };
+    LocalSearch collided(instance);
+    collided.setEvaluationCache(poisoned());
+    int previous = initial.makespan;
+    collided.setIterationCallback([&](int, int makespan) {
+        assert(makespan < previous && "Accepted moves must improve");
+        previous = makespan;
+        return true;
+    });
+    assert(collided.improveSchedule(initial, 1000).second == descent &&
+           "Corrected collisions should leave the descent unchanged");
+    
+    tabu.cache = poisoned();
+    TabuResult tabuCollided = TabuSearch(instance).run(initial, tabu);
+    assert(FeasibilityChecker::isValid(tabuCollided.best, instance));
+    assert(MakespanCalculator::calculate(tabuCollided.best) == tabuCollided.bestMakespan);
+    
+    annealing.cache = poisoned();
+    AnnealingResult annealCollided = SimulatedAnnealing(instance).run(initial, annealing);
+    assert(FeasibilityChecker::isValid(annealCollided.best, instance));
+    assert(MakespanCalculator::calculate(annealCollided.best) == annealCollided.bestMakespan);
+    
+    std::cout << "  ✓ Passed\n\n";
+}
+
+void testSearchAllocations() {
+    std::cout << "Test 18: Allocation-Free Search Iterations\n";
+    ProblemInstance instance = createRandomInstance(30, 10, 47);
+    Schedule initial = DispatchHeuristics(instance).buildSPTSchedule();
+    
+    // Isınmadan sonra ayırmalar sadece dönen çizelgenin kopyasıdır: iterasyon sayısından bağımsız
+    LocalSearch search(instance);
+    for (int warmup = 0; warmup < 2; ++warmup) {
+        search.improveSchedule(initial, 50);
+    }
+    AllocationCounter::Scope one;
+    search.improveSchedule(initial, 1);
+    long long perCall = one.count();
+    AllocationCounter::Scope many;
+    auto [improved, makespan] = search.improveSchedule(initial, 50);
+    std::cout << "  LocalSearch: " << perCall << " allocations per call, "
+              << many.count() - perCall << " per 50 iterations\n";
+    assert(many.count() == perCall && "Search iterations should not allocate");
+    assert(makespan < initial.makespan);
+    
+    // Paralel yol da (görevler FunctionRef ile verilir) çağıran iş parçacığında ayırmaz
+    LocalSearch parallel(instance);
+    parallel.setThreadCount(4);
+    for (int warmup = 0; warmup < 2; ++warmup) {
+        parallel.improveSchedule(initial, 50);
+    }
+    AllocationCounter::Scope parallelOne;
+    parallel.improveSchedule(initial, 1);
+    long long parallelPerCall = parallelOne.count();
+    AllocationCounter::Scope parallelMany;
+    parallel.improveSchedule(initial, 50);
+    assert(parallelMany.count() == parallelPerCall && "Parallel iterations should not allocate");
+    
+    // Tabu: yasak tablosu düz ve önceden ayrılmıştır; daha uzun arama daha çok ayırmaz
+    TabuSearch tabu(instance);
+    TabuOptions tabuOptions;
+    tabuOptions.maxIterations = 400;
+    tabu.run(initial, tabuOptions);
+    AllocationCounter::Scope shortRun;
+    tabu.run(initial, tabuOptions);
+    long long shortAllocations = shortRun.count();
+    tabuOptions.maxIterations = 1200;
+    AllocationCounter::Scope longRun;
+    tabu.run(initial, tabuOptions);
+    std::cout << "  Tabu: " << shortAllocations << " allocations for 400 iterations, "
+              << longRun.count() << " for 1200\n";
+    assert(longRun.count() == shortAllocations && "Tabu iterations should not allocate");
+    
+    std::cout << "  ✓ Passed\n\n";
+}
+
 int main() {
     std::cout << "=== Heuristics and Local Search Tests ===\n\n";
 
@@ -178,7 +871,20 @@ int main() {
         testLJF();
         testCriticalPath();
         testLocalSearch();
+        testLocalSearchEstimateMode();
+        testParallelLocalSearch();
+        testActiveSchedules();
+        testPortfolioSolver();
+        testTabuSearch();
         testAllHeuristicsComparison();
+        testStreamingParser();
+        testBenchmarkLoader();
+        testGeneticAlgorithm();
+        testSimulatedAnnealing();
+        testAnytimeSolver();
+        testLowerBounds();
+        testEvaluationCache();
+        testSearchAllocations();
 
         std::cout << "=== All tests passed! ===\n";
         return 0;
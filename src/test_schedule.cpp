@@ -1,9 +1,23 @@
 #include <iostream>
 #include <cassert>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <filesystem>
+#include <fstream>
 #include "ScheduleDecoder.h"
 #include "MakespanCalculator.h"
 #include "FeasibilityChecker.h"
+#include "AllocationCounter.h"
+#include "BatchEvaluator.h"
+#include "EvaluationCache.h"
+#include "ScheduleHash.h"
+#include "Move.h"
+#include "CriticalPathAnalyzer.h"
+#include "Snapshot.h"
+#include "InputParser.h"
 #include "Models.h"
+#include "nlohmann/json.hpp"
 
 // Basit bir test örneği oluşturan yardımcı fonksiyon
 ProblemInstance createTestInstance() {
@@ -15,29 +29,76 @@ ProblemInstance createTestInstance() {
 
     // Job1 oluştur: M1'de op0 (süre 5), M2'de op1 (süre 3)
     std::vector<Operation> job1Ops;
-    job1Ops.emplace_back("J1", 0, "M1", 5);
-    job1Ops.emplace_back("J1", 1, "M2", 3);
+    job1Ops.emplace_back(0, instance.intern("M1"), 5);
+    job1Ops.emplace_back(1, instance.intern("M2"), 3);
     instance.jobs["J1"] = std::make_unique<Job>("J1", std::move(job1Ops));
 
     // Job2 oluştur: M2'de op0 (süre 2), M1'de op1 (süre 4)
     std::vector<Operation> job2Ops;
-    job2Ops.emplace_back("J2", 0, "M2", 2);
-    job2Ops.emplace_back("J2", 1, "M1", 4);
+    job2Ops.emplace_back(0, instance.intern("M2"), 2);
+    job2Ops.emplace_back(1, instance.intern("M1"), 4);
     instance.jobs["J2"] = std::make_unique<Job>("J2", std::move(job2Ops));
 
     return instance;
 }
 
+// Rastgele (ama tekrarlanabilir) bir jobs x machines örneği oluşturur:
+// her iş tüm makineleri rastgele bir sırada ziyaret eder
+ProblemInstance createRandomInstance(int numJobs, int numMachines, unsigned seed) {
+    ProblemInstance instance;
+    std::mt19937 rng(seed);
+
+    for (int m = 0; m < numMachines; ++m) {
+        std::string mid = "M" + std::to_string(m);
+        instance.machines[mid] = std::make_unique<Machine>(mid);
+    }
+
+    for (int j = 0; j < numJobs; ++j) {
+        std::string jid = "J" + std::to_string(j);
+        std::vector<int> route(numMachines);
+        std::iota(route.begin(), route.end(), 0);
+        std::shuffle(route.begin(), route.end(), rng);
+
+        std::vector<Operation> ops;
+        for (int k = 0; k < numMachines; ++k) {
+            int duration = 1 + static_cast<int>(rng() % 20);
+            ops.emplace_back(k, instance.intern("M" + std::to_string(route[k])), duration);
+        }
+        instance.jobs[jid] = std::make_unique<Job>(jid, std::move(ops));
+    }
+
+    return instance;
+}
+
+// İşlem indeksi turlarına göre (önce tüm işlerin op0'ı, sonra op1'i...) uygulanabilir bir çizelge
+Schedule createRoundRobinSchedule(const ProblemInstance& instance) {
+    const CompiledInstance& ci = instance.compiled();
+    std::vector<std::vector<int>> sequences(ci.numMachines());
+    for (int k = 0; ; ++k) {
+        bool any = false;
+        for (int j = 0; j < ci.numJobs(); ++j) {
+            if (k < ci.jobLength(j)) {
+                int op = ci.opId(j, k);
+                sequences[ci.opMachine[op]].push_back(op);
+                any = true;
+            }
+        }
+        if (!any) break;
+    }
+    return Schedule::fromSequences(ci, sequences);
+}
+
 void testValidSchedule() {
     std::cout << "Test 1: Valid Schedule\n";
     ProblemInstance instance = createTestInstance();
-    Schedule schedule;
+    std::unordered_map<std::string, std::vector<NamedOpKey>> machineOrder;
 
     // Makine M1: J1.op0, J2.op1
-    schedule.machineOrder["M1"] = {OpKey{"J1", 0}, OpKey{"J2", 1}};
+    machineOrder["M1"] = {NamedOpKey{"J1", 0}, NamedOpKey{"J2", 1}};
     
     // Makine M2: J2.op0, J1.op1
-    schedule.machineOrder["M2"] = {OpKey{"J2", 0}, OpKey{"J1", 1}};
+    machineOrder["M2"] = {NamedOpKey{"J2", 0}, NamedOpKey{"J1", 1}};
+    Schedule schedule = Schedule::fromMachineOrder(instance.compiled(), machineOrder);
 
     // Çöz
     bool decoded = ScheduleDecoder::decode(schedule, instance);
@@ -53,13 +114,13 @@ void testValidSchedule() {
     assert(makespan > 0 && "Makespan should be positive");
 
     // İş önceliğini doğrula: J1.op1, J1.op0 bittikten sonra başlamalı
-    int j1_op0_end = schedule.opTimes.at("J1").at(0).end;
-    int j1_op1_start = schedule.opTimes.at("J1").at(1).start;
+    int j1_op0_end = schedule.timeOf(NamedOpKey{"J1", 0}).end;
+    int j1_op1_start = schedule.timeOf(NamedOpKey{"J1", 1}).start;
     assert(j1_op1_start >= j1_op0_end && "J1.op1 must start after J1.op0 finishes");
 
     // Makine kısıtını doğrula: M1 işlemleri sıralı olmalı
-    int j1_op0_end_m1 = schedule.opTimes.at("J1").at(0).end;
-    int j2_op1_start_m1 = schedule.opTimes.at("J2").at(1).start;
+    int j1_op0_end_m1 = schedule.timeOf(NamedOpKey{"J1", 0}).end;
+    int j2_op1_start_m1 = schedule.timeOf(NamedOpKey{"J2", 1}).start;
     assert(j2_op1_start_m1 >= j1_op0_end_m1 && "M1 operations must be sequential");
 
     std::cout << "  ✓ Passed\n\n";
@@ -68,20 +129,21 @@ void testValidSchedule() {
 void testPrecedenceViolation() {
     std::cout << "Test 2: Precedence Violation Detection\n";
     ProblemInstance instance = createTestInstance();
-    Schedule schedule;
+    std::unordered_map<std::string, std::vector<NamedOpKey>> machineOrder;
 
     // J1.op1'in J1.op0 bitmeden başladığı bir çizelge oluştur
     // Bu, geçersiz zamanları manuel olarak ayarlayarak yapılır
-    schedule.machineOrder["M1"] = {OpKey{"J1", 0}};
-    schedule.machineOrder["M2"] = {OpKey{"J1", 1}};
+    machineOrder["M1"] = {NamedOpKey{"J1", 0}};
+    machineOrder["M2"] = {NamedOpKey{"J1", 1}};
+    Schedule schedule = Schedule::fromMachineOrder(instance.compiled(), machineOrder);
 
     // Önce çöz
     bool decoded = ScheduleDecoder::decode(schedule, instance);
     assert(decoded && "Decoding should succeed");
 
     // Şimdi manuel olarak bir öncelik ihlali oluştur
-    schedule.opTimes["J1"][0] = TimeWindow{0, 5};
-    schedule.opTimes["J1"][1] = TimeWindow{3, 6}; // 3'te başlıyor, ama op0 5'te bitiyor - İHLAL
+    schedule.setTimeOf(NamedOpKey{"J1", 0}, TimeWindow{0, 5});
+    schedule.setTimeOf(NamedOpKey{"J1", 1}, TimeWindow{3, 6}); // 3'te başlıyor, ama op0 5'te bitiyor - İHLAL
 
     bool feasible = FeasibilityChecker::isValid(schedule, instance);
     assert(!feasible && "Schedule with precedence violation should be invalid");
@@ -92,19 +154,20 @@ void testPrecedenceViolation() {
 void testMachineOverlap() {
     std::cout << "Test 3: Machine Overlap Detection\n";
     ProblemInstance instance = createTestInstance();
-    Schedule schedule;
+    std::unordered_map<std::string, std::vector<NamedOpKey>> machineOrder;
 
     // Aynı makinede çakışan işlemlerle bir çizelge oluştur
-    schedule.machineOrder["M1"] = {OpKey{"J1", 0}, OpKey{"J2", 1}};
-    schedule.machineOrder["M2"] = {OpKey{"J2", 0}, OpKey{"J1", 1}};
+    machineOrder["M1"] = {NamedOpKey{"J1", 0}, NamedOpKey{"J2", 1}};
+    machineOrder["M2"] = {NamedOpKey{"J2", 0}, NamedOpKey{"J1", 1}};
+    Schedule schedule = Schedule::fromMachineOrder(instance.compiled(), machineOrder);
 
     // Önce çöz
     bool decoded = ScheduleDecoder::decode(schedule, instance);
     assert(decoded && "Decoding should succeed");
 
     // Şimdi M1'de manuel olarak bir çakışma oluştur
-    schedule.opTimes["J1"][0] = TimeWindow{0, 5};
-    schedule.opTimes["J2"][1] = TimeWindow{3, 7}; // J1.op0 ile çakışıyor - İHLAL
+    schedule.setTimeOf(NamedOpKey{"J1", 0}, TimeWindow{0, 5});
+    schedule.setTimeOf(NamedOpKey{"J2", 1}, TimeWindow{3, 7}); // J1.op0 ile çakışıyor - İHLAL
 
     bool feasible = FeasibilityChecker::isValid(schedule, instance);
     assert(!feasible && "Schedule with machine overlap should be invalid");
@@ -115,10 +178,11 @@ void testMachineOverlap() {
 void testMakespanCalculation() {
     std::cout << "Test 4: Makespan Calculation\n";
     ProblemInstance instance = createTestInstance();
-    Schedule schedule;
+    std::unordered_map<std::string, std::vector<NamedOpKey>> machineOrder;
 
-    schedule.machineOrder["M1"] = {OpKey{"J1", 0}, OpKey{"J2", 1}};
-    schedule.machineOrder["M2"] = {OpKey{"J2", 0}, OpKey{"J1", 1}};
+    machineOrder["M1"] = {NamedOpKey{"J1", 0}, NamedOpKey{"J2", 1}};
+    machineOrder["M2"] = {NamedOpKey{"J2", 0}, NamedOpKey{"J1", 1}};
+    Schedule schedule = Schedule::fromMachineOrder(instance.compiled(), machineOrder);
 
     bool decoded = ScheduleDecoder::decode(schedule, instance);
     assert(decoded && "Decoding should succeed");
@@ -127,15 +191,14 @@ void testMakespanCalculation() {
     
     // Makespan'ın maksimum bitiş zamanı olduğunu doğrula
     int maxEnd = -1;
-    for (const auto& [jobId, opTimes] : schedule.opTimes) {
-        for (const auto& [opIndex, timeWindow] : opTimes) {
-            if (timeWindow.end > maxEnd) {
-                maxEnd = timeWindow.end;
-            }
+    for (int end : schedule.endTime) {
+        if (end > maxEnd) {
+            maxEnd = end;
         }
     }
     
     assert(makespan == maxEnd && "Makespan should equal maximum end time");
+    assert(schedule.endTime[schedule.makespanOp] == makespan && "makespanOp should end at makespan");
     std::cout << "  Makespan: " << makespan << " (max end time: " << maxEnd << ")\n";
     std::cout << "  ✓ Passed\n\n";
 }
@@ -150,22 +213,23 @@ void testComplexSchedule() {
 
     // Job1: M1(10) -> M2(5) -> M3(8)
     std::vector<Operation> job1Ops;
-    job1Ops.emplace_back("J1", 0, "M1", 10);
-    job1Ops.emplace_back("J1", 1, "M2", 5);
-    job1Ops.emplace_back("J1", 2, "M3", 8);
+    job1Ops.emplace_back(0, instance.intern("M1"), 10);
+    job1Ops.emplace_back(1, instance.intern("M2"), 5);
+    job1Ops.emplace_back(2, instance.intern("M3"), 8);
     instance.jobs["J1"] = std::make_unique<Job>("J1", std::move(job1Ops));
 
     // Job2: M2(3) -> M1(7) -> M3(4)
     std::vector<Operation> job2Ops;
-    job2Ops.emplace_back("J2", 0, "M2", 3);
-    job2Ops.emplace_back("J2", 1, "M1", 7);
-    job2Ops.emplace_back("J2", 2, "M3", 4);
+    job2Ops.emplace_back(0, instance.intern("M2"), 3);
+    job2Ops.emplace_back(1, instance.intern("M1"), 7);
+    job2Ops.emplace_back(2, instance.intern("M3"), 4);
     instance.jobs["J2"] = std::make_unique<Job>("J2", std::move(job2Ops));
 
-    Schedule schedule;
-    schedule.machineOrder["M1"] = {OpKey{"J1", 0}, OpKey{"J2", 1}};
-    schedule.machineOrder["M2"] = {OpKey{"J2", 0}, OpKey{"J1", 1}};
-    schedule.machineOrder["M3"] = {OpKey{"J1", 2}, OpKey{"J2", 2}};
+    std::unordered_map<std::string, std::vector<NamedOpKey>> machineOrder;
+    machineOrder["M1"] = {NamedOpKey{"J1", 0}, NamedOpKey{"J2", 1}};
+    machineOrder["M2"] = {NamedOpKey{"J2", 0}, NamedOpKey{"J1", 1}};
+    machineOrder["M3"] = {NamedOpKey{"J1", 2}, NamedOpKey{"J2", 2}};
+    Schedule schedule = Schedule::fromMachineOrder(instance.compiled(), machineOrder);
 
     bool decoded = ScheduleDecoder::decode(schedule, instance);
     assert(decoded && "Decoding should succeed");
@@ -178,9 +242,708 @@ void testComplexSchedule() {
     assert(makespan > 0 && "Makespan should be positive");
 
     // Tüm işlemlerin çizelgelendiğini doğrula
-    assert(schedule.opTimes["J1"].size() == 3 && "J1 should have 3 operations scheduled");
-    assert(schedule.opTimes["J2"].size() == 3 && "J2 should have 3 operations scheduled");
+    const CompiledInstance& ci = instance.compiled();
+    for (int k = 0; k < 3; ++k) {
+        assert(schedule.isScheduled(ci.findOp("J1", k)) && "J1 should have 3 operations scheduled");
+        assert(schedule.isScheduled(ci.findOp("J2", k)) && "J2 should have 3 operations scheduled");
+    }
+
+    std::cout << "  ✓ Passed\n\n";
+}
+
+void testCompiledInstance() {
+    std::cout << "Test 6: Compiled Instance Layout\n";
+    ProblemInstance instance = createTestInstance();
+    const CompiledInstance& ci = instance.compiled();
+
+    assert(ci.numJobs() == 2 && ci.numMachines() == 2 && ci.numOps() == 4);
+
+    // İş ve makine id'leri sıralı yoğun indekslere eşlenmeli
+    assert(ci.findJob("J1") == 0 && ci.findJob("J2") == 1);
+    assert(ci.findMachine("M1") == 0 && ci.findMachine("M2") == 1);
+    assert(ci.findJob("J9") == -1 && ci.findOp("J1", 2) == -1);
+
+    // J2.op1: M1, süre 4
+    int op = ci.findOp("J2", 1);
+    assert(op == ci.jobOffset[1] + 1);
+    assert(ci.opMachine[op] == ci.findMachine("M1") && ci.opDuration[op] == 4);
+    assert(ci.keyOf(op).job == instance.ids->find("J2") && ci.keyOf(op).opIndex == 1);
+    assert(ci.nameOf(op).jobId == "J2" && ci.findOp(ci.keyOf(op)) == op);
+    assert(ci.jobTotalTime[0] == 8 && ci.machineOpCount[0] == 2);
+
+    std::cout << "  ✓ Passed\n\n";
+}
+
+void testCycleDetection() {
+    std::cout << "Test 7: Cycle Detection\n";
+    ProblemInstance instance = createTestInstance();
+    std::unordered_map<std::string, std::vector<NamedOpKey>> machineOrder;
+
+    // M1: J2.op1 önce, M2: J1.op1 önce -> J2.op1 J2.op0'ı, J2.op0 J1.op1'i,
+    // J1.op1 J1.op0'ı, J1.op0 J2.op1'i bekler: döngü
+    machineOrder["M1"] = {NamedOpKey{"J2", 1}, NamedOpKey{"J1", 0}};
+    machineOrder["M2"] = {NamedOpKey{"J1", 1}, NamedOpKey{"J2", 0}};
+    Schedule schedule = Schedule::fromMachineOrder(instance.compiled(), machineOrder);
+
+    auto status = ScheduleDecoder::decodeWithStatus(schedule, instance);
+    assert(status == ScheduleDecoder::Status::Cycle && "Cyclic machine orders should be reported");
+    assert(!ScheduleDecoder::decode(schedule, instance));
+
+    // Yanlış makine ve tekrar eden işlem de raporlanmalı
+    machineOrder["M1"] = {NamedOpKey{"J1", 1}};
+    machineOrder["M2"] = {};
+    schedule = Schedule::fromMachineOrder(instance.compiled(), machineOrder);
+    assert(ScheduleDecoder::decodeWithStatus(schedule, instance) == ScheduleDecoder::Status::WrongMachine);
+
+    machineOrder["M1"] = {NamedOpKey{"J1", 0}, NamedOpKey{"J1", 0}};
+    schedule = Schedule::fromMachineOrder(instance.compiled(), machineOrder);
+    assert(ScheduleDecoder::decodeWithStatus(schedule, instance) == ScheduleDecoder::Status::DuplicateOperation);
+
+    std::cout << "  ✓ Passed (correctly detected cycle)\n\n";
+}
+
+void testIncrementalRedecode() {
+    std::cout << "Test 8: Incremental Re-decoding Matches Full Decode\n";
+    ProblemInstance instance = createRandomInstance(12, 6, 42);
+    Schedule schedule = createRoundRobinSchedule(instance);
+    bool decoded = ScheduleDecoder::decode(schedule, instance);
+    assert(decoded && "Round-robin schedule should decode");
+
+    std::mt19937 rng(7);
+    int accepted = 0;
+    int cycles = 0;
+    for (int iter = 0; iter < 2000; ++iter) {
+        int m = static_cast<int>(rng() % schedule.numMachines());
+        if (schedule.machineSize(m) < 2) continue;
+        int a = schedule.machineBegin(m) + static_cast<int>(rng() % (schedule.machineSize(m) - 1));
+
+        // Beklenen sonuç: swap + tam çözme
+        Schedule expected = schedule;
+        expected.swapPositions(a, a + 1);
+        auto fullStatus = ScheduleDecoder::decodeWithStatus(expected, instance);
+
+        auto status = ScheduleDecoder::redecodeAdjacentSwap(schedule, instance, a);
+        assert(status == fullStatus && "Incremental cycle detection should match full decode");
+
+        if (status == ScheduleDecoder::Status::Ok) {
+            accepted++;
+            assert(schedule.startTime == expected.startTime && "Start times should match");
+            assert(schedule.endTime == expected.endTime && "End times should match");
+            assert(schedule.makespan == expected.makespan && "Makespan should match");
+            assert(schedule.endTime[schedule.makespanOp] == schedule.makespan);
+        } else {
+            cycles++;
+        }
+    }
+
+    assert(FeasibilityChecker::isValid(schedule, instance));
+    std::cout << "  Accepted swaps: " << accepted << ", rejected (cycle): " << cycles << "\n";
+    std::cout << "  ✓ Passed\n\n";
+}
+
+void testTails() {
+    std::cout << "Test 9: Heads and Tails\n";
+    ProblemInstance instance = createRandomInstance(10, 5, 3);
+    Schedule schedule = createRoundRobinSchedule(instance);
+    bool decoded = ScheduleDecoder::decode(schedule, instance);
+    assert(decoded && "Round-robin schedule should decode");
+
+    std::vector<int> tails;
+    ScheduleDecoder::computeTails(schedule, instance, tails);
+
+    // baş + süre + kuyruk, işlemden geçen en uzun yoldur: en fazla makespan,
+    // ve makespan'ı belirleyen işlem için tam olarak makespan
+    const CompiledInstance& ci = instance.compiled();
+    int longest = 0;
+    for (int op = 0; op < ci.numOps(); ++op) {
+        int through = schedule.startTime[op] + ci.opDuration[op] + tails[op];
+        assert(through <= schedule.makespan && "Path through op cannot exceed makespan");
+        longest = std::max(longest, through);
+    }
+    assert(longest == schedule.makespan && "Longest path should equal makespan");
+    assert(tails[schedule.makespanOp] == 0 && "Last op on critical path has zero tail");
+
+    std::cout << "  ✓ Passed\n\n";
+}
+
+void testMoveApplyUndo() {
+    std::cout << "Test 10: Move Apply/Undo\n";
+    ProblemInstance instance = createRandomInstance(10, 5, 11);
+    Schedule schedule = createRoundRobinSchedule(instance);
+    bool decoded = ScheduleDecoder::decode(schedule, instance);
+    assert(decoded && "Round-robin schedule should decode");
+
+    const Schedule original = schedule;
+    std::mt19937 rng(5);
+    MoveJournal journal;
+    for (int iter = 0; iter < 500; ++iter) {
+        int a = static_cast<int>(rng() % (schedule.sequence.size() - 1));
+        int m = instance.compiled().opMachine[schedule.sequence[a]];
+        if (a + 1 >= schedule.machineEnd(m)) continue;
+
+        SwapMove move(a);
+        if (!move.apply(schedule, instance, journal)) {
+            // Reddedilen hamle çizelgeyi değiştirmemeli
+            assert(schedule.sequence == original.sequence);
+            continue;
+        }
+        move.undo(schedule, journal);
+
+        assert(schedule.sequence == original.sequence && "Undo should restore order");
+        assert(schedule.position == original.position && "Undo should restore positions");
+        assert(schedule.startTime == original.startTime && "Undo should restore times");
+        assert(schedule.makespan == original.makespan && schedule.makespanOp == original.makespanOp);
+    }
+
+    std::cout << "  ✓ Passed\n\n";
+}
+
+void testInsertionRedecode() {
+    std::cout << "Test 11: Incremental Insertion Matches Full Decode\n";
+    ProblemInstance instance = createRandomInstance(12, 6, 21);
+    Schedule schedule = createRoundRobinSchedule(instance);
+    bool decoded = ScheduleDecoder::decode(schedule, instance);
+    assert(decoded && "Round-robin schedule should decode");
+
+    std::mt19937 rng(13);
+    MoveJournal journal;
+    int accepted = 0;
+    int cycles = 0;
+    for (int iter = 0; iter < 2000; ++iter) {
+        int m = static_cast<int>(rng() % schedule.numMachines());
+        if (schedule.machineSize(m) < 2) continue;
+        int from = schedule.machineBegin(m) + static_cast<int>(rng() % schedule.machineSize(m));
+        int to = schedule.machineBegin(m) + static_cast<int>(rng() % schedule.machineSize(m));
+        if (from == to) continue;
+
+        // Beklenen sonuç: taşıma + tam çözme
+        Schedule expected = schedule;
+        expected.moveOperation(from, to);
+        auto fullStatus = ScheduleDecoder::decodeWithStatus(expected, instance);
+
+        const Schedule before = schedule;
+        InsertMove move(from, to);
+        bool applied = move.apply(schedule, instance, journal);
+        assert(applied == (fullStatus == ScheduleDecoder::Status::Ok) &&
+               "Insertion cycle detection should match full decode");
+
+        if (!applied) {
+            cycles++;
+            assert(schedule.sequence == before.sequence && "Rejected move should not change order");
+            continue;
+        }
+        accepted++;
+        assert(schedule.sequence == expected.sequence);
+        assert(schedule.startTime == expected.startTime && "Start times should match");
+        assert(schedule.makespan == expected.makespan && "Makespan should match");
+
+        // Her dört hamleden birini geri al
+        if (iter % 4 == 0) {
+            move.undo(schedule, journal);
+            assert(schedule.sequence == before.sequence && schedule.position == before.position);
+            assert(schedule.startTime == before.startTime && schedule.makespan == before.makespan);
+        }
+    }
+
+    assert(FeasibilityChecker::isValid(schedule, instance));
+    std::cout << "  Accepted moves: " << accepted << ", rejected (cycle): " << cycles << "\n";
+    std::cout << "  ✓ Passed\n\n";
+}
+
+void testCriticalPathAnalysis() {
+    std::cout << "Test 12: Critical Path and Slack Analysis\n";
+    ProblemInstance instance = createRandomInstance(10, 5, 17);
+    const CompiledInstance& ci = instance.compiled();
+    Schedule schedule = createRoundRobinSchedule(instance);
+    bool decoded = ScheduleDecoder::decode(schedule, instance);
+    assert(decoded && "Round-robin schedule should decode");
+
+    CriticalPathAnalysis analysis = CriticalPathAnalyzer::analyze(schedule, instance);
+    assert(analysis.makespan == schedule.makespan);
+
+    // Yol 0'da başlar, makespan'da biter ve her adım sıkıdır (boşluk yok)
+    const std::vector<int>& path = analysis.path;
+    assert(!path.empty());
+    assert(schedule.startTime[path.front()] == 0);
+    assert(schedule.endTime[path.back()] == schedule.makespan);
+    for (size_t i = 0; i + 1 < path.size(); ++i) {
+        assert(schedule.endTime[path[i]] == schedule.startTime[path[i + 1]] && "Path must be tight");
+    }
+
+    // Yoldaki işlemler kritiktir; gevşeklikler negatif olamaz ve serbest <= toplam
+    for (int op : path) {
+        assert(analysis.isCritical(op));
+    }
+    for (int op = 0; op < ci.numOps(); ++op) {
+        assert(analysis.totalSlack[op] >= 0 && analysis.freeSlack[op] >= 0);
+        assert(analysis.freeSlack[op] <= analysis.totalSlack[op]);
+    }
+
+    // Bloklar yolu sırayla ve eksiksiz kapsar
+    size_t covered = 0;
+    for (const CriticalBlock& block : analysis.blocks) {
+        for (int pos = block.begin; pos <= block.end; ++pos) {
+            assert(schedule.sequence[pos] == path[covered++]);
+            assert(ci.opMachine[schedule.sequence[pos]] == block.machine);
+        }
+    }
+    assert(covered == path.size());
+
+    // Toplam gevşeklik kadar geciktirmek makespan'ı değiştirmez, bir fazlası değiştirir.
+    // Eski başlangıç zamanları grafiğin topolojik sırasını verir.
+    std::vector<int> order(schedule.sequence.begin(), schedule.sequence.end());
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        return schedule.startTime[a] < schedule.startTime[b];
+    });
+    auto makespanWithDelay = [&](int delayedOp, int minStart) {
+        std::vector<int> end(ci.numOps(), 0);
+        int makespan = 0;
+        for (int x : order) {
+            int start = ci.opIndexOf(x) > 0 ? end[x - 1] : 0;
+            int pos = schedule.position[x];
+            if (pos > schedule.machineBegin(ci.opMachine[x])) {
+                start = std::max(start, end[schedule.sequence[pos - 1]]);
+            }
+            if (x == delayedOp) start = std::max(start, minStart);
+            end[x] = start + ci.opDuration[x];
+            makespan = std::max(makespan, end[x]);
+        }
+        return makespan;
+    };
+    for (int op = 0; op < ci.numOps(); op += 7) {
+        int latest = schedule.startTime[op] + analysis.totalSlack[op];
+        assert(makespanWithDelay(op, latest) == schedule.makespan);
+        assert(makespanWithDelay(op, latest + 1) == schedule.makespan + 1);
+    }
+
+    std::cout << "  Path length: " << path.size() << " ops in " << analysis.blocks.size()
+              << " blocks\n";
+    std::cout << "  ✓ Passed\n\n";
+}
+
+void testSnapshotRoundTrip() {
+    std::cout << "Test 13: Binary Snapshot Round Trip\n";
+    ProblemInstance instance = createRandomInstance(8, 4, 3);
+    const CompiledInstance& ci = instance.compiled();
+    Schedule schedule = createRoundRobinSchedule(instance);
+    bool decoded = ScheduleDecoder::decode(schedule, instance);
+    assert(decoded && "Round-robin schedule should decode");
+
+    const std::filesystem::path dir = std::filesystem::temp_directory_path();
+    const std::string instancePath = (dir / "jssp_test_instance.jsnap").string();
+    const std::string schedulePath = (dir / "jssp_test_schedule.jsnap").string();
+    const std::string jsonPath = (dir / "jssp_test_instance.json").string();
+
+    // Instance: eşlenen görünüm yoğun dizileri aynen verir
+    Snapshot::writeInstance(instance, instancePath);
+    {
+        MappedInstance mapped(instancePath);
+        assert(mapped.numJobs() == ci.numJobs() && mapped.numOps() == ci.numOps());
+        assert(mapped.fingerprint() == Snapshot::fingerprint(ci));
+        assert(std::equal(ci.opDuration.begin(), ci.opDuration.end(), mapped.opDuration()));
+        assert(std::equal(ci.remainingWork.begin(), ci.remainingWork.end(), mapped.remainingWork()));
+        assert(mapped.machineId(1) == ci.machineIds[1] && mapped.jobId(0) == ci.jobIds[0]);
+
+        ProblemInstance loaded = mapped.toProblemInstance();
+        assert(Snapshot::fingerprint(loaded.compiled()) == Snapshot::fingerprint(ci));
+        assert(loaded.jobs.size() == instance.jobs.size());
+        assert(loaded.machineName(loaded.getJob("J3")->operations()[2]) ==
+               instance.machineName(instance.getJob("J3")->operations()[2]));
+
+        // Yüklenen instance ile çizelge aynı makespan'a çözülür
+        Schedule again = Schedule::fromMachineOrder(loaded.compiled(), schedule.machineOrder());
+        assert(ScheduleDecoder::decode(again, loaded) && again.makespan == schedule.makespan);
+    }
+
+    // Schedule: zamanlar ve makespan yeniden çözmeden geri gelir
+    Snapshot::writeSchedule(schedule, schedulePath);
+    Schedule restored = Snapshot::readSchedule(instance, schedulePath);
+    assert(restored.sequence == schedule.sequence && restored.position == schedule.position);
+    assert(restored.startTime == schedule.startTime && restored.makespan == schedule.makespan);
+    assert(FeasibilityChecker::isValid(restored, instance));
+
+    // Başka bir instance'ın çizelgesi ve bozuk dosyalar reddedilir
+    ProblemInstance other = createRandomInstance(8, 4, 4);
+    bool rejected = false;
+    try { Snapshot::readSchedule(other, schedulePath); } catch (const std::runtime_error&) { rejected = true; }
+    assert(rejected && "Fingerprint mismatch should be rejected");
+
+    // Türetilmiş bir dizideki elle yapılmış değişiklik (makine işlem sayısı) reddedilir
+    {
+        std::fstream file(instancePath, std::ios::in | std::ios::out | std::ios::binary);
+        SnapshotHeader header;
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        std::int32_t count = 0;
+        file.seekg(static_cast<std::streamoff>(header.sectionOffset[6]));
+        file.read(reinterpret_cast<char*>(&count), sizeof(count));
+        count += 1000;
+        file.seekp(static_cast<std::streamoff>(header.sectionOffset[6]));
+        file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    }
+    rejected = false;
+    try { MappedInstance corrupt(instancePath); } catch (const std::runtime_error&) { rejected = true; }
+    assert(rejected && "Inconsistent machine op counts should be rejected");
+
+    std::filesystem::resize_file(instancePath, std::filesystem::file_size(instancePath) - 8);
+    rejected = false;
+    try { MappedInstance truncated(instancePath); } catch (const std::runtime_error&) { rejected = true; }
+    assert(rejected && "Truncated snapshot should be rejected");
+
+    // JSON'a geri dönüştürme InputParser ile aynı instance'ı verir
+    Snapshot::writeInstanceJson(instance, jsonPath);
+    ProblemInstance parsed = InputParser::parseFromJsonFile(jsonPath);
+    assert(Snapshot::fingerprint(parsed.compiled()) == Snapshot::fingerprint(ci));
+
+    std::cout << "  ✓ Passed\n\n";
+}
+
+void testFeasibilityReport() {
+    std::cout << "Test 14: Feasibility Diagnostics\n";
+    ProblemInstance instance = createTestInstance();
+    const CompiledInstance& ci = instance.compiled();
+    std::unordered_map<std::string, std::vector<NamedOpKey>> machineOrder;
+    machineOrder["M1"] = {NamedOpKey{"J1", 0}, NamedOpKey{"J2", 1}};
+    machineOrder["M2"] = {NamedOpKey{"J2", 0}, NamedOpKey{"J1", 1}};
+    Schedule schedule = Schedule::fromMachineOrder(ci, machineOrder);
+    bool decoded = ScheduleDecoder::decode(schedule, instance);
+    assert(decoded && "Decoding should succeed");
+    assert(FeasibilityChecker::diagnose(schedule, instance).feasible());
+
+    // Öncelik ve çakışma aynı anda: hepsi raporlanır, ilgili işlemlerle
+    schedule.setTimeOf(NamedOpKey{"J1", 0}, TimeWindow{0, 5});
+    schedule.setTimeOf(NamedOpKey{"J1", 1}, TimeWindow{3, 6});
+    schedule.setTimeOf(NamedOpKey{"J2", 1}, TimeWindow{4, 8});
+    FeasibilityReport report = FeasibilityChecker::diagnose(schedule, instance);
+    assert(!report.feasible() && !FeasibilityChecker::isValid(schedule, instance));
+
+    int j1op0 = ci.findOp("J1", 0), j1op1 = ci.findOp("J1", 1), j2op1 = ci.findOp("J2", 1);
+    bool precedence = false, overlap = false;
+    for (const Violation& v : report.violations) {
+        std::cout << "  " << FeasibilityChecker::describe(v, schedule, instance) << "\n";
+        if (v.kind == ViolationKind::Precedence && v.op == j1op1 && v.otherOp == j1op0) precedence = true;
+        if (v.kind == ViolationKind::MachineOverlap && v.op == j2op1 && v.otherOp == j1op0) overlap = true;
+    }
+    assert(precedence && overlap);
+
+    // Eksik zaman ve yanlış makine
+    Schedule broken = schedule;
+    broken.setTimeOf(NamedOpKey{"J2", 0}, TimeWindow{-1, -1});
+    broken.swapPositions(broken.position[j1op0], broken.position[ci.findOp("J2", 0)]);
+    report = FeasibilityChecker::diagnose(broken, instance);
+    int missing = 0, wrongMachine = 0;
+    for (const Violation& v : report.violations) {
+        if (v.kind == ViolationKind::MissingOperation) {
+            assert(v.op == ci.findOp("J2", 0));
+            ++missing;
+        }
+        if (v.kind == ViolationKind::WrongMachine) ++wrongMachine;
+    }
+    assert(missing == 1 && "Missing op is reported once");
+    assert(wrongMachine == 2);
+
+    // Başka örneğin çizelgesi
+    ProblemInstance other = createTestInstance();
+    report = FeasibilityChecker::diagnose(schedule, other);
+    assert(report.violations.size() == 1 &&
+           report.violations[0].kind == ViolationKind::LayoutMismatch);
+
+    // isValid ve diagnose rastgele bozulmalarda aynı kararı verir
+    ProblemInstance random = createRandomInstance(8, 5, 3);
+    Schedule base = createRoundRobinSchedule(random);
+    decoded = ScheduleDecoder::decode(base, random);
+    assert(decoded);
+    std::mt19937 rng(11);
+    for (int trial = 0; trial < 200; ++trial) {
+        Schedule s = base;
+        int op = static_cast<int>(rng() % s.startTime.size());
+        int shift = static_cast<int>(rng() % 21) - 10;
+        s.setTimeWindow(op, TimeWindow{s.startTime[op] + shift, s.endTime[op] + shift});
+        bool valid = FeasibilityChecker::isValid(s, random);
+        assert(valid == FeasibilityChecker::diagnose(s, random).feasible());
+    }
+
+    std::cout << "  ✓ Passed\n\n";
+}
+
+void testBatchEvaluation() {
+    std::cout << "Test 15: Batched Candidate Evaluation\n";
+    ProblemInstance instance = createRandomInstance(10, 5, 21);
+    const CompiledInstance& ci = instance.compiled();
+    Schedule base = createRoundRobinSchedule(instance);
+    const int numOps = ci.numOps();
+
+    // Rastgele makine içi swap'larla adaylar; bazıları döngü içerir
+    std::mt19937 rng(5);
+    std::vector<Schedule> candidates;
+    std::vector<int> flat;
+    for (int c = 0; c < 300; ++c) {
+        Schedule s = base;
+        for (int k = 0; k < 1 + c % 6; ++k) {
+            int m = static_cast<int>(rng() % ci.numMachines());
+            int a = s.machineBegin(m) + static_cast<int>(rng() % s.machineSize(m));
+            int b = s.machineBegin(m) + static_cast<int>(rng() % s.machineSize(m));
+            s.swapPositions(a, b);
+        }
+        flat.insert(flat.end(), s.sequence.begin(), s.sequence.end());
+        candidates.push_back(std::move(s));
+    }
+
+    BatchEvaluator evaluator(instance);
+    std::vector<int> serial = evaluator.evaluate(flat);
+    assert(static_cast<int>(serial.size()) == 300);
+    int cycles = 0;
+    for (int c = 0; c < 300; ++c) {
+        Schedule s = candidates[c];
+        bool ok = ScheduleDecoder::decode(s, instance);
+        assert(serial[c] == (ok ? MakespanCalculator::calculate(s) : -1));
+        cycles += ok ? 0 : 1;
+    }
+    assert(cycles > 0 && "Some random candidates should be cyclic");
+
+    // Paralel sonuç seriyle aynı; Schedule girişi de aynı sonucu verir
+    evaluator.setThreadCount(4);
+    assert(evaluator.evaluate(flat) == serial);
+    assert(evaluator.evaluate(candidates) == serial);
+
+    // Yanlış makine ve tekrarlanan işlem geçersizdir
+    std::vector<int> bad(base.sequence.begin(), base.sequence.end());
+    std::swap(bad[evaluator.machineBegin(0)], bad[evaluator.machineBegin(1)]);
+    std::vector<int> duplicate(base.sequence.begin(), base.sequence.end());
+    duplicate[1] = duplicate[0];
+    bad.insert(bad.end(), duplicate.begin(), duplicate.end());
+    std::vector<int> invalid = evaluator.evaluate(bad);
+    assert(invalid.size() == 2 && invalid[0] == -1 && invalid[1] == -1);
+    assert(static_cast<int>(bad.size()) == 2 * numOps);
+
+    std::cout << "  ✓ Passed (" << cycles << " cyclic candidates rejected)\n\n";
+}
+
+void testScheduleHashAndCache() {
+    std::cout << "Test 16: Schedule Hash and Evaluation Cache\n";
+    ProblemInstance instance = createRandomInstance(10, 5, 33);
+    const CompiledInstance& ci = instance.compiled();
+    Schedule s = createRoundRobinSchedule(instance);
+    const std::uint64_t original = ScheduleHash::compute(s);
+
+    // Artımlı güncelleme her hamleden sonra baştan hesaplamayla aynı
+    std::mt19937 rng(9);
+    std::uint64_t hash = original;
+    for (int k = 0; k < 500; ++k) {
+        int m = static_cast<int>(rng() % ci.numMachines());
+        int from = s.machineBegin(m) + static_cast<int>(rng() % s.machineSize(m));
+        int to = s.machineBegin(m) + static_cast<int>(rng() % s.machineSize(m));
+        hash = ScheduleHash::afterInsert(hash, s, from, to);
+        s.moveOperation(from, to);
+        assert(hash == ScheduleHash::compute(s));
+    }
+    assert(hash != original && "500 random moves should change the order");
+
+    // A/B sonra B/A: özet başlangıca döner; farklı sıra farklı özet verir
+    Schedule t = createRoundRobinSchedule(instance);
+    std::uint64_t swapped = ScheduleHash::afterSwap(original, t, 0);
+    assert(swapped != original);
+    t.swapPositions(0, 1);
+    assert(ScheduleHash::afterSwap(swapped, t, 0) == original);
+
+    // Sınırlı önbellek: döngülü sıralar -1, ezilen kayıtlar sayılır
+    EvaluationCache cache(128);
+    assert(cache.capacity() >= 128 && cache.capacity() < 256);
+    int makespan = 0;
+    assert(!cache.lookup(original, makespan));
+    cache.insert(original, 42);
+    cache.insert(swapped, -1);
+    assert(cache.lookup(original, makespan) && makespan == 42);
+    assert(cache.lookup(swapped, makespan) && makespan == -1);
+    for (std::uint64_t key = 1; key <= 1000; ++key) {
+        cache.insert(key * 0x9e3779b97f4a7c15ULL, static_cast<int>(key));
+    }
+    EvaluationCacheStats stats = cache.stats();
+    assert(stats.lookups == 3 && stats.hits == 2 && stats.inserts == 1002);
+    assert(stats.evictions >= 1002 - static_cast<long long>(cache.capacity()));
+    cache.clear();
+    assert(!cache.lookup(original, makespan) && cache.stats().hits == 0);
+
+    std::cout << "  ✓ Passed\n\n";
+}
+
+void testDecoderWorkspace() {
+    std::cout << "Test 17: Decoder Workspace and Allocation Counts\n";
+    ProblemInstance instance = createRandomInstance(20, 8, 45);
+    const CompiledInstance& ci = instance.compiled();
+    Schedule schedule = createRoundRobinSchedule(instance);
+
+    // Açık çalışma alanı iş parçacığı alanıyla aynı sonucu verir
+    DecoderWorkspace workspace;
+    Schedule other = schedule;
+    assert(ScheduleDecoder::decodeWithStatus(other, instance, workspace) == ScheduleDecoder::Status::Ok);
+    assert(ScheduleDecoder::decode(schedule, instance));
+    assert(other.startTime == schedule.startTime && other.makespan == schedule.makespan);
+    std::vector<int> tails;
+    std::vector<int> tailsWs;
+    ScheduleDecoder::computeTails(schedule, instance, tails);
+    ScheduleDecoder::computeTails(schedule, instance, tailsWs, workspace);
+    assert(tails == tailsWs);
+
+    // Isınmadan sonra çözme, kuyruklar ve hamle uygula/geri al yığından ayırmaz
+    std::mt19937 rng(8);
+    MoveJournal journal;
+    auto neighbors = [&]() {
+        for (int k = 0; k < 200; ++k) {
+            int m = static_cast<int>(rng() % ci.numMachines());
+            int from = schedule.machineBegin(m) + static_cast<int>(rng() % schedule.machineSize(m));
+            int to = schedule.machineBegin(m) + static_cast<int>(rng() % schedule.machineSize(m));
+            InsertMove move(from, to);
+            if (move.apply(schedule, instance, journal)) {
+                move.undo(schedule, journal);
+            }
+        }
+    };
+    for (int warmup = 0; warmup < 2; ++warmup) {
+        neighbors();
+        rng.seed(8);
+    }
+    AllocationCounter::Scope scope;
+    ScheduleDecoder::decode(schedule, instance);
+    ScheduleDecoder::decodeWithStatus(other, instance, workspace);
+    ScheduleDecoder::computeTails(schedule, instance, tails);
+    neighbors();
+    assert(scope.count() == 0 && "Steady-state evaluation should not allocate");
+
+    // Sayaç bu iş parçacığındaki ayırmaları görür
+    AllocationCounter::Scope copies;
+    Schedule copy = schedule;
+    assert(copies.count() >= 1 && copy.makespan == schedule.makespan);
+
+    std::cout << "  ✓ Passed\n\n";
+}
+
+void testInternedIds() {
+    std::cout << "Test 18: Interned Ids and Compact Keys\n";
+    static_assert(sizeof(OpKey) <= 8, "OpKey is a compact integer record");
+    static_assert(sizeof(Operation) <= 16, "Operation holds no strings");
+
+    IdTable table;
+    assert(table.intern("M1") == 0 && table.intern("M2") == 1 && table.intern("M1") == 0);
+    assert(table.size() == 2 && table.find("M2") == 1 && table.find("M9") == -1);
+    assert(table.name(1) == "M2");
+
+    ProblemInstance instance = createTestInstance();
+    const CompiledInstance& ci = instance.compiled();
+    const Operation& op = instance.getJob("J2")->operations()[1];
+    assert(instance.machineName(op) == "M1" && op.index() == 1);
+
+    // Tamsayı ve string anahtarlar aynı operasyonu gösterir
+    Schedule schedule = createRoundRobinSchedule(instance);
+    assert(ScheduleDecoder::decode(schedule, instance));
+    for (int o = 0; o < ci.numOps(); ++o) {
+        NamedOpKey name = ci.nameOf(o);
+        assert(ci.findOp(name.jobId, name.opIndex) == o && ci.findOp(ci.keyOf(o)) == o);
+        assert(schedule.timeOf(ci.keyOf(o)).start == schedule.timeOf(name).start);
+    }
+    assert(ci.findOp(OpKey{instance.ids->size(), 0}) == -1 && ci.findOp(OpKey{-1, 0}) == -1);
+    assert(ci.findOp(OpKey{instance.ids->find("J1"), 9}) == -1);
+    assert(ci.findOp(OpKey{instance.ids->find("M1"), 0}) == -1);  // makine kimliği iş değildir
+    assert(ci.ids == instance.ids);  // makineler ve işler tek tabloda
+
+    // machineOrder string kimliklerle dışa ve geri aynı sıraya döner
+    Schedule rebuilt = Schedule::fromMachineOrder(ci, schedule.machineOrder());
+    assert(rebuilt.sequence == schedule.sequence);
+
+    // OpKey yeniden derlemeden sonra da aynı operasyonu gösterir (yoğun indeksler kaysa bile)
+    int oldOp = ci.findOp("J2", 1);
+    OpKey j2op1 = ci.keyOf(oldOp);
+    std::string machineOfJ2op1 = ci.machineIds[ci.opMachine[oldOp]];
+    std::vector<Operation> firstOps;
+    firstOps.emplace_back(0, instance.intern("M2"), 1);
+    instance.jobs["J0"] = std::make_unique<Job>("J0", std::move(firstOps));
+    instance.compile();
+    const CompiledInstance& recompiled = instance.compiled();
+    int moved = recompiled.findOp(j2op1);
+    assert(recompiled.findJob("J0") == 0 && moved == recompiled.findOp("J2", 1) && moved != oldOp);
+    assert(recompiled.nameOf(moved).jobId == "J2" && recompiled.opDuration[moved] == 4);
+    assert(recompiled.machineIds[recompiled.opMachine[moved]] == machineOfJ2op1);
+
+    // Eski görünümle kurulan çizelge geçerli kalır ve yeni görünüme taşınabilir
+    assert(schedule.layout == &ci && schedule.layout != &recompiled);
+    Schedule carried = Schedule::fromMachineOrder(recompiled, schedule.machineOrder());
+    assert(carried.layout == &recompiled && carried.sequence.size() == schedule.sequence.size());
+    assert(carried.position[moved] >= 0);
+
+    // Silinen işin anahtarı artık çözülmez
+    instance.jobs.erase("J2");
+    instance.compile();
+    assert(instance.compiled().findOp(j2op1) == -1);
+
+    // Makine listesinde olmayan bir kimlik derlemede reddedilir
+    ProblemInstance broken = createTestInstance();
+    std::vector<Operation> ops;
+    ops.emplace_back(0, broken.intern("M7"), 1);
+    broken.jobs["J3"] = std::make_unique<Job>("J3", std::move(ops));
+    bool threw = false;
+    try {
+        broken.compiled();
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "  ✓ Passed\n\n";
+}
+
+void testInputParserOrder() {
+    std::cout << "Test 19: Input Parser Validation Order\n";
+
+    const std::string path = (std::filesystem::temp_directory_path() / "jssp_parser_order.json").string();
+    // Dosyayı yazıp ayrıştırır; hata yoksa "" döner
+    auto errorOf = [&](const std::string& text) -> std::string {
+        {
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            out << text;
+        }
+        try {
+            InputParser::parseFromJsonFile(path);
+        } catch (const std::runtime_error& e) {
+            return e.what();
+        }
+        return "";
+    };
+    const std::string validJobs =
+        R"("jobs": [{"id": "J1", "operations": [{"machine": "M1", "duration": 3}]}])";
+    const std::string badJobs =
+        R"("jobs": [{"id": "J1", "operations": [{"machine": "M9", "duration": 3}]},)"
+        R"( {"id": " ", "operations": [{"machine": "M1", "duration": 0}]}])";
+
+    assert(errorOf("{" + validJobs + R"(, "machines": ["M1"]})").empty());
+
+    // Makine listesi, dosyadaki konumundan bağımsız olarak işlerden önce denetlenir
+    assert(errorOf("{" + badJobs + "}") == "Input error: `machines` must be an array");
+    assert(errorOf("{" + badJobs + R"(, "machines": "M1"})") == "Input error: `machines` must be an array");
+    assert(errorOf("{" + badJobs + R"(, "machines": ["M1"]})") ==
+           "Input error: unknown machine M9 in job J1 op 0");
+    assert(errorOf(R"({"machines": ["M1", 7], )" + badJobs + "}") ==
+           "Input error: each machine id must be a string");
+    assert(errorOf(R"({"machines": ["M1"], "jobs": {}})") == "Input error: `jobs` must be an array");
+
+    // Tekrarlanan anahtarda son değer geçerlidir (DOM ayrıştırıcısındaki gibi)
+    assert(errorOf(R"({"machines": ["M1"], )" + validJobs + R"(, "machines": ["M2"]})") ==
+           "Input error: unknown machine M1 in job J1 op 0");
+    assert(errorOf(R"({"machines": ["M1"], )" + validJobs + R"(, "jobs": []})") ==
+           "Input error: jobs list cannot be empty");
+    assert(errorOf(R"({"machines": 5, )" + validJobs + R"(, "machines": ["M1"]})").empty());
+    assert(errorOf(R"({"machines": ["M1"], "jobs": [{"id": 1, "id": "J1", "operations": [)"
+                   R"({"machine": "M1", "duration": 0, "duration": 2}]}]})").empty());
+
+    // Kök nesne değilse doğrulama hatası, bozuk JSON ise ayrıştırma hatası verilir
+    assert(errorOf(R"(["M1"])") == "Input error: root must be a JSON object");
+    bool malformed = false;
+    try {
+        errorOf(R"({"machines": 5, "jobs": [)");
+    } catch (const nlohmann::json::parse_error&) {
+        malformed = true;
+    }
+    assert(malformed && "Malformed JSON should be reported before validation errors");
 
+    std::filesystem::remove(path);
     std::cout << "  ✓ Passed\n\n";
 }
 
@@ -193,6 +956,20 @@ int main() {
         testMachineOverlap();
         testMakespanCalculation();
         testComplexSchedule();
+        testCompiledInstance();
+        testCycleDetection();
+        testIncrementalRedecode();
+        testTails();
+        testMoveApplyUndo();
+        testInsertionRedecode();
+        testCriticalPathAnalysis();
+        testSnapshotRoundTrip();
+        testFeasibilityReport();
+        testBatchEvaluation();
+        testScheduleHashAndCache();
+        testDecoderWorkspace();
+        testInternedIds();
+        testInputParserOrder();
 
         std::cout << "=== All tests passed! ===\n";
         return 0;
@@ -0,0 +1,78 @@
+#include "AllocationCounter.h"
+#include <cstdlib>
+#include <new>
+
+// Sayan global operator new/delete yerine koyucuları. Kütüphanenin parçası
+// değildir: sadece ayırma sayan hedefler (test_*, microbench) bu dosyayı
+// derler, böylece kütüphaneyi kullanan programların ayırıcısı değişmez.
+
+namespace {
+
+void* allocate(std::size_t size) noexcept {
+    AllocationCounter::record();
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* allocateAligned(std::size_t size, std::align_val_t align) noexcept {
+    AllocationCounter::record();
+    std::size_t alignment = static_cast<std::size_t>(align);
+    if (alignment < sizeof(void*)) {
+        alignment = sizeof(void*);
+    }
+    void* p = nullptr;
+    if (posix_memalign(&p, alignment, size == 0 ? 1 : size) != 0) {
+        return nullptr;
+    }
+    return p;
+}
+
+void* allocateOrThrow(std::size_t size) {
+    if (void* p = allocate(size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* allocateAlignedOrThrow(std::size_t size, std::align_val_t align) {
+    if (void* p = allocateAligned(size, align)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+} // namespace
+
+// Global operator new/delete'in tüm biçimleri (tekil, dizi, nothrow, hizalı) burada
+// değiştirilir: çalışma zamanı veya bir sanitizer kendi nothrow/dizi sürümünü
+// sağlasa bile her ayırma malloc/posix_memalign ile yapılıp free ile serbest bırakılır.
+void* operator new(std::size_t size) { return allocateOrThrow(size); }
+void* operator new[](std::size_t size) { return allocateOrThrow(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+
+void* operator new(std::size_t size, std::align_val_t align) {
+    return allocateAlignedOrThrow(size, align);
+}
+void* operator new[](std::size_t size, std::align_val_t align) {
+    return allocateAlignedOrThrow(size, align);
+}
+void* operator new(std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return allocateAligned(size, align);
+}
+void* operator new[](std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return allocateAligned(size, align);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }